@@ -0,0 +1,72 @@
+/**
+ * @file ads1115_bus_posix.c
+ * @brief ADS1115 Shared-Bus Arbitration on POSIX Threads - Implementation (POSIX)
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ * @details Link with -pthread.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "ads1115_bus_posix.h"
+#include <stddef.h>
+
+/**
+ * @addtogroup ADS1115_Bus_Posix
+ * @{
+ */
+
+/*===========================================================================*/
+/* PRIVATE FUNCTIONS                                                         */
+/*===========================================================================*/
+
+static void posix_lock(void *os_ctx)
+{
+    pthread_mutex_lock(&((ads1115_bus_posix_t *)os_ctx)->mutex);
+}
+
+static void posix_unlock(void *os_ctx)
+{
+    pthread_mutex_unlock(&((ads1115_bus_posix_t *)os_ctx)->mutex);
+}
+
+static void posix_wait(void *os_ctx)
+{
+    ads1115_bus_posix_t *os = (ads1115_bus_posix_t *)os_ctx;
+    pthread_cond_wait(&os->cond, &os->mutex);
+}
+
+static void posix_broadcast(void *os_ctx)
+{
+    pthread_cond_broadcast(&((ads1115_bus_posix_t *)os_ctx)->cond);
+}
+
+/*===========================================================================*/
+/* PUBLIC API IMPLEMENTATIONS                                                */
+/*===========================================================================*/
+
+ads1115_error_t ads1115_bus_posix_init(ads1115_bus_t *bus, ads1115_bus_posix_t *os)
+{
+    if (bus == NULL || os == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (pthread_mutex_init(&os->mutex, NULL) != 0)
+        return ADS1115_ERROR_INVALID_PARAM;
+    if (pthread_cond_init(&os->cond, NULL) != 0)
+    {
+        pthread_mutex_destroy(&os->mutex);
+        return ADS1115_ERROR_INVALID_PARAM;
+    }
+    return ads1115_bus_init(bus, posix_lock, posix_unlock, posix_wait, posix_broadcast, os);
+}
+
+ads1115_error_t ads1115_bus_posix_deinit(ads1115_bus_posix_t *os)
+{
+    if (os == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    pthread_cond_destroy(&os->cond);
+    pthread_mutex_destroy(&os->mutex);
+    return ADS1115_OK;
+}
+
+/** @} */ // End of ADS1115_Bus_Posix
@@ -0,0 +1,60 @@
+/**
+ * @file ads1115_bus_posix.h
+ * @brief ADS1115 Shared-Bus Arbitration on POSIX Threads - Interface Declarations
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ *
+ * @details Supplies the mutex and condition variable of an @ref ads1115_bus_t
+ * with pthreads, for Linux hosts where several threads drive handles on the
+ * same I2C bus.
+ */
+
+#ifndef ADS1115_BUS_POSIX_H
+#define ADS1115_BUS_POSIX_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include "ads1115_bus.h"
+#include <pthread.h>
+
+/**
+ * @defgroup ADS1115_Bus_Posix POSIX Bus Arbitration
+ * @ingroup ADS1115_Interface
+ * @brief pthread mutex/condition backing for the shared bus.
+ * @{
+ */
+
+/**
+ * @brief Synchronisation objects owned by one bus.
+ */
+typedef struct
+{
+    pthread_mutex_t mutex; /**< Protects the bus state */
+    pthread_cond_t cond;   /**< Signalled when the bus is released */
+} ads1115_bus_posix_t;
+
+/**
+ * @brief Creates the pthread objects and initializes @p bus with them.
+ * @param bus Pointer to the bus.
+ * @param os Storage for the pthread objects; must outlive the bus.
+ * @return ADS1115_ERROR_INVALID_PARAM if the objects cannot be created.
+ */
+ads1115_error_t ads1115_bus_posix_init(ads1115_bus_t *bus, ads1115_bus_posix_t *os);
+
+/**
+ * @brief Destroys the pthread objects; no handle may be using the bus.
+ * @param os Storage passed to @ref ads1115_bus_posix_init.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_bus_posix_deinit(ads1115_bus_posix_t *os);
+
+/** @} */ // End of ADS1115_Bus_Posix
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADS1115_BUS_POSIX_H */
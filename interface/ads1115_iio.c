@@ -0,0 +1,466 @@
+/**
+ * @file ads1115_iio.c
+ * @brief ADS1115 Linux IIO Buffered-Mode Backend - Implementation
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "ads1115_iio.h"
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/**
+ * @addtogroup ADS1115_IIO
+ * @{
+ */
+
+/*===========================================================================*/
+/* PRIVATE CONSTANTS                                                         */
+/*===========================================================================*/
+
+/** @brief Size of the staging buffer used for one batched read() */
+#define IIO_READ_CHUNK 2048U
+
+/** @brief Sysfs channel names used by ti-ads1015, indexed by @ref ads1115_mux_t */
+static const char *const IIO_CHANNEL_NAMES[ADS1115_IIO_CHANNELS] = {
+    "voltage0-voltage1", "voltage0-voltage3", "voltage1-voltage3", "voltage2-voltage3",
+    "voltage0", "voltage1", "voltage2", "voltage3"};
+
+/**
+ * @brief in_*_scale values (mV per LSB) indexed by @ref ads1115_range_t.
+ * @details The kernel parses the fraction in micro units and matches
+ * (micro << 15) / 10^6 against its full-scale table, so 1/128 mV must be written
+ * rounded up: 7812 would give 255 instead of 256.
+ */
+static const char *const IIO_SCALES[] = {"0.187500", "0.125000", "0.062500", "0.031250", "0.015625", "0.007813"};
+
+/** @brief in_*_sampling_frequency values indexed by @ref ads1115_data_rate_t */
+static const char *const IIO_RATES[] = {"8", "16", "32", "64", "128", "250", "475", "860"};
+
+/*===========================================================================*/
+/* PRIVATE FUNCTIONS                                                         */
+/*===========================================================================*/
+
+/**
+ * @brief Writes a string attribute below the device directory.
+ */
+static ads1115_error_t sysfs_write(const ads1115_iio_t *iio, const char *attr, const char *value)
+{
+    char path[ADS1115_IIO_PATH_MAX * 2];
+    snprintf(path, sizeof(path), "%s/%s", iio->sysfs_dir, attr);
+
+    int fd = open(path, O_WRONLY | O_TRUNC);
+    if (fd < 0)
+        return ADS1115_ERROR_I2C_WRITE;
+    size_t len = strlen(value);
+    ssize_t written = write(fd, value, len);
+    close(fd);
+    return written == (ssize_t)len ? ADS1115_OK : ADS1115_ERROR_I2C_WRITE;
+}
+
+/**
+ * @brief Reads a string attribute, stripping the trailing newline.
+ */
+static ads1115_error_t sysfs_read(const char *dir, const char *attr, char *value, size_t size)
+{
+    char path[ADS1115_IIO_PATH_MAX * 2];
+    snprintf(path, sizeof(path), "%s/%s", dir, attr);
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return ADS1115_ERROR_I2C_READ;
+    ssize_t n = read(fd, value, size - 1U);
+    close(fd);
+    if (n <= 0)
+        return ADS1115_ERROR_I2C_READ;
+    value[n] = '\0';
+    value[strcspn(value, "\n")] = '\0';
+    return ADS1115_OK;
+}
+
+/**
+ * @brief Parses a scan element type such as "be:s16/16>>0".
+ */
+static bool parse_element_type(const char *type, ads1115_iio_element_t *element)
+{
+    char endian, sign;
+    unsigned realbits, storagebits, shift;
+    if (sscanf(type, "%ce:%c%u/%u>>%u", &endian, &sign, &realbits, &storagebits, &shift) != 5)
+        return false;
+    if ((storagebits != 16U && storagebits != 32U && storagebits != 64U) || realbits == 0U || realbits > storagebits)
+        return false;
+    element->big_endian = endian == 'b';
+    element->is_signed = sign == 's';
+    element->realbits = (uint8_t)realbits;
+    element->bytes = (uint8_t)(storagebits / 8U);
+    element->shift = (uint8_t)shift;
+    return true;
+}
+
+/**
+ * @brief Extracts one element value from a buffer record.
+ */
+static int64_t decode_element(const uint8_t *record, const ads1115_iio_element_t *element)
+{
+    uint64_t value = 0;
+    for (uint8_t i = 0; i < element->bytes; i++)
+    {
+        uint8_t byte = element->big_endian ? record[element->offset + i]
+                                           : record[element->offset + element->bytes - 1U - i];
+        value = (value << 8) | byte;
+    }
+    value >>= element->shift;
+    if (element->realbits < 64U)
+    {
+        uint64_t mask = ((uint64_t)1 << element->realbits) - 1U;
+        value &= mask;
+        if (element->is_signed && (value >> (element->realbits - 1U)) != 0U)
+            value |= ~mask;
+    }
+    return (int64_t)value;
+}
+
+/**
+ * @brief Enables/disables one scan element and reads its layout when enabled.
+ */
+static ads1115_error_t configure_element(ads1115_iio_t *iio, const char *name, bool enable,
+                                         ads1115_iio_element_t *element, uint32_t *index)
+{
+    char attr[96];
+    char value[32];
+    ads1115_error_t err;
+
+    snprintf(attr, sizeof(attr), "scan_elements/in_%s_en", name);
+    if ((err = sysfs_write(iio, attr, enable ? "1" : "0")) != ADS1115_OK || !enable)
+        return err;
+
+    snprintf(attr, sizeof(attr), "scan_elements/in_%s_type", name);
+    if ((err = sysfs_read(iio->sysfs_dir, attr, value, sizeof(value))) != ADS1115_OK)
+        return err;
+    if (!parse_element_type(value, element))
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    snprintf(attr, sizeof(attr), "scan_elements/in_%s_index", name);
+    if ((err = sysfs_read(iio->sysfs_dir, attr, value, sizeof(value))) != ADS1115_OK)
+        return err;
+    *index = (uint32_t)strtoul(value, NULL, 10);
+    return ADS1115_OK;
+}
+
+/*===========================================================================*/
+/* PUBLIC API IMPLEMENTATIONS                                                */
+/*===========================================================================*/
+
+ads1115_error_t ads1115_iio_init(ads1115_iio_t *iio, const char *sysfs_dir, const char *dev_path)
+{
+    if (iio == NULL || sysfs_dir == NULL || dev_path == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (strlen(sysfs_dir) >= ADS1115_IIO_PATH_MAX || strlen(dev_path) >= ADS1115_IIO_PATH_MAX)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    memset(iio, 0, sizeof(*iio));
+    strcpy(iio->sysfs_dir, sysfs_dir);
+    strcpy(iio->dev_path, dev_path);
+    iio->fd = -1;
+
+    char value[32];
+    ads1115_error_t err = sysfs_read(sysfs_dir, "name", value, sizeof(value));
+    if (err != ADS1115_OK)
+        return err;
+    if (strcmp(value, "ads1015") == 0)
+    {
+        /* Mainline ti-ads1015 names every chip it drives "ads1015"; the 16-bit part
+         * is told apart by its scan element type (s16/16>>0 vs s12/16>>4) */
+        char attr[64];
+        ads1115_iio_element_t element;
+        snprintf(attr, sizeof(attr), "scan_elements/in_%s_type", IIO_CHANNEL_NAMES[ADS1115_MUX_AIN0_GND]);
+        if (sysfs_read(sysfs_dir, attr, value, sizeof(value)) != ADS1115_OK || !parse_element_type(value, &element) ||
+            element.realbits != 16U || element.shift != 0U)
+            return ADS1115_ERROR_INVALID_PARAM;
+    }
+    else if (strcmp(value, "ads1115") != 0)
+    {
+        return ADS1115_ERROR_INVALID_PARAM;
+    }
+
+    for (uint8_t ch = 0; ch < ADS1115_IIO_CHANNELS; ch++)
+    {
+        char attr[64];
+        iio->range[ch] = ADS1115_RANGE_2V048;
+        iio->data_rate[ch] = ADS1115_DR_128_SPS;
+
+        snprintf(attr, sizeof(attr), "in_%s_scale", IIO_CHANNEL_NAMES[ch]);
+        if (sysfs_read(sysfs_dir, attr, value, sizeof(value)) == ADS1115_OK)
+        {
+            double scale = strtod(value, NULL);
+            for (uint8_t r = 0; r <= ADS1115_RANGE_0V256; r++)
+            {
+                double ref = strtod(IIO_SCALES[r], NULL);
+                if (scale > ref * 0.99 && scale < ref * 1.01)
+                    iio->range[ch] = (ads1115_range_t)r;
+            }
+        }
+        snprintf(attr, sizeof(attr), "in_%s_sampling_frequency", IIO_CHANNEL_NAMES[ch]);
+        if (sysfs_read(sysfs_dir, attr, value, sizeof(value)) == ADS1115_OK)
+        {
+            for (uint8_t r = 0; r <= ADS1115_DR_860_SPS; r++)
+            {
+                if (strcmp(value, IIO_RATES[r]) == 0)
+                    iio->data_rate[ch] = (ads1115_data_rate_t)r;
+            }
+        }
+    }
+
+    iio->is_initialized = true;
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_iio_find(ads1115_iio_t *iio, const char *sysfs_root, const char *dev_root)
+{
+    if (iio == NULL || sysfs_root == NULL || dev_root == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+
+    DIR *dir = opendir(sysfs_root);
+    if (dir == NULL)
+        return ADS1115_ERROR_NOT_INITIALIZED;
+
+    ads1115_error_t err = ADS1115_ERROR_NOT_INITIALIZED;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL)
+    {
+        if (strncmp(entry->d_name, "iio:device", 10) != 0)
+            continue;
+        char sysfs_dir[ADS1115_IIO_PATH_MAX];
+        char dev_path[ADS1115_IIO_PATH_MAX];
+        if (snprintf(sysfs_dir, sizeof(sysfs_dir), "%s/%s", sysfs_root, entry->d_name) >= (int)sizeof(sysfs_dir) ||
+            snprintf(dev_path, sizeof(dev_path), "%s/%s", dev_root, entry->d_name) >= (int)sizeof(dev_path))
+            continue;
+        if (ads1115_iio_init(iio, sysfs_dir, dev_path) == ADS1115_OK)
+        {
+            err = ADS1115_OK;
+            break;
+        }
+    }
+    closedir(dir);
+    return err;
+}
+
+ads1115_error_t ads1115_iio_deinit(ads1115_iio_t *iio)
+{
+    if (iio == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (iio->buffer_enabled)
+        ads1115_iio_buffer_stop(iio);
+    iio->is_initialized = false;
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_iio_set_range(ads1115_iio_t *iio, ads1115_mux_t mux, ads1115_range_t range)
+{
+    if (!iio->is_initialized)
+        return ADS1115_ERROR_NOT_INITIALIZED;
+    if (mux > ADS1115_MUX_AIN3_GND || range > ADS1115_RANGE_0V256)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    char attr[64];
+    snprintf(attr, sizeof(attr), "in_%s_scale", IIO_CHANNEL_NAMES[mux]);
+    ads1115_error_t err = sysfs_write(iio, attr, IIO_SCALES[range]);
+    if (err == ADS1115_OK)
+        iio->range[mux] = range;
+    return err;
+}
+
+ads1115_error_t ads1115_iio_set_data_rate(ads1115_iio_t *iio, ads1115_mux_t mux, ads1115_data_rate_t data_rate)
+{
+    if (!iio->is_initialized)
+        return ADS1115_ERROR_NOT_INITIALIZED;
+    if (mux > ADS1115_MUX_AIN3_GND || data_rate > ADS1115_DR_860_SPS)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    char attr[64];
+    snprintf(attr, sizeof(attr), "in_%s_sampling_frequency", IIO_CHANNEL_NAMES[mux]);
+    ads1115_error_t err = sysfs_write(iio, attr, IIO_RATES[data_rate]);
+    if (err == ADS1115_OK)
+        iio->data_rate[mux] = data_rate;
+    return err;
+}
+
+ads1115_error_t ads1115_iio_single_read(ads1115_iio_t *iio, ads1115_mux_t mux, int16_t *adc_raw, float *voltage)
+{
+    if (!iio->is_initialized)
+        return ADS1115_ERROR_NOT_INITIALIZED;
+    if (!adc_raw || !voltage)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (mux > ADS1115_MUX_AIN3_GND)
+        return ADS1115_ERROR_INVALID_PARAM;
+    if (iio->buffer_enabled)
+        return ADS1115_ERROR_CONVERSION_BUSY;
+
+    char attr[64];
+    char value[32];
+    snprintf(attr, sizeof(attr), "in_%s_raw", IIO_CHANNEL_NAMES[mux]);
+    ads1115_error_t err = sysfs_read(iio->sysfs_dir, attr, value, sizeof(value));
+    if (err != ADS1115_OK)
+        return err;
+    *adc_raw = (int16_t)strtol(value, NULL, 10);
+    return ads1115_raw_to_voltage(iio->range[mux], *adc_raw, voltage);
+}
+
+ads1115_error_t ads1115_iio_set_scan_channels(ads1115_iio_t *iio, uint8_t scan_mask, bool timestamp)
+{
+    if (!iio->is_initialized)
+        return ADS1115_ERROR_NOT_INITIALIZED;
+    /* ti-ads1015 validates scan masks as one-hot: one channel per buffer run */
+    if (scan_mask == 0U || (scan_mask & (scan_mask - 1U)) != 0U)
+        return ADS1115_ERROR_INVALID_PARAM;
+    if (iio->buffer_enabled)
+        return ADS1115_ERROR_CONVERSION_BUSY;
+
+    uint32_t index[ADS1115_IIO_CHANNELS + 1U];
+    ads1115_error_t err;
+    iio->scan_mask = 0;
+    for (uint8_t ch = 0; ch < ADS1115_IIO_CHANNELS; ch++)
+    {
+        if ((scan_mask & ADS1115_IIO_SCAN_BIT(ch)) == 0U &&
+            (err = configure_element(iio, IIO_CHANNEL_NAMES[ch], false, &iio->elements[ch], &index[ch])) != ADS1115_OK)
+            return err;
+    }
+    for (uint8_t ch = 0; ch < ADS1115_IIO_CHANNELS; ch++)
+    {
+        if ((scan_mask & ADS1115_IIO_SCAN_BIT(ch)) != 0U &&
+            (err = configure_element(iio, IIO_CHANNEL_NAMES[ch], true, &iio->elements[ch], &index[ch])) != ADS1115_OK)
+            return err;
+    }
+    if ((err = configure_element(iio, "timestamp", timestamp, &iio->ts_element, &index[ADS1115_IIO_CHANNELS])) != ADS1115_OK)
+        return err;
+
+    /* Lay elements out in scan index order, each aligned to its own size */
+    uint16_t offset = 0;
+    uint8_t largest = 1;
+    uint32_t last_index = 0;
+    bool first = true;
+    for (;;)
+    {
+        ads1115_iio_element_t *next = NULL;
+        uint32_t next_index = 0;
+        for (uint8_t ch = 0; ch <= ADS1115_IIO_CHANNELS; ch++)
+        {
+            bool enabled = ch < ADS1115_IIO_CHANNELS ? (scan_mask & ADS1115_IIO_SCAN_BIT(ch)) != 0U : timestamp;
+            if (!enabled || (!first && index[ch] <= last_index))
+                continue;
+            if (next == NULL || index[ch] < next_index)
+            {
+                next = ch < ADS1115_IIO_CHANNELS ? &iio->elements[ch] : &iio->ts_element;
+                next_index = index[ch];
+            }
+        }
+        if (next == NULL)
+            break;
+        offset = (uint16_t)((offset + next->bytes - 1U) / next->bytes * next->bytes);
+        next->offset = (uint8_t)offset;
+        offset = (uint16_t)(offset + next->bytes);
+        if (next->bytes > largest)
+            largest = next->bytes;
+        last_index = next_index;
+        first = false;
+    }
+
+    iio->record_bytes = (uint16_t)((offset + largest - 1U) / largest * largest);
+    if (iio->record_bytes > IIO_READ_CHUNK)
+        return ADS1115_ERROR_INVALID_PARAM;
+    iio->scan_mask = scan_mask;
+    iio->timestamp = timestamp;
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_iio_buffer_start(ads1115_iio_t *iio, uint32_t length, const char *trigger)
+{
+    if (!iio->is_initialized)
+        return ADS1115_ERROR_NOT_INITIALIZED;
+    if (iio->scan_mask == 0U || length == 0U)
+        return ADS1115_ERROR_INVALID_PARAM;
+    if (iio->buffer_enabled)
+        return ADS1115_ERROR_CONVERSION_BUSY;
+
+    char value[16];
+    ads1115_error_t err;
+    snprintf(value, sizeof(value), "%lu", (unsigned long)length);
+    if ((err = sysfs_write(iio, "buffer/length", value)) != ADS1115_OK)
+        return err;
+    if (trigger && (err = sysfs_write(iio, "trigger/current_trigger", trigger)) != ADS1115_OK)
+        return err;
+    if ((err = sysfs_write(iio, "buffer/enable", "1")) != ADS1115_OK)
+        return err;
+
+    iio->fd = open(iio->dev_path, O_RDONLY | O_NONBLOCK);
+    if (iio->fd < 0)
+    {
+        sysfs_write(iio, "buffer/enable", "0");
+        return ADS1115_ERROR_I2C_READ;
+    }
+    iio->buffer_enabled = true;
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_iio_buffer_stop(ads1115_iio_t *iio)
+{
+    if (!iio->is_initialized)
+        return ADS1115_ERROR_NOT_INITIALIZED;
+    if (iio->fd >= 0)
+    {
+        close(iio->fd);
+        iio->fd = -1;
+    }
+    iio->buffer_enabled = false;
+    return sysfs_write(iio, "buffer/enable", "0");
+}
+
+ads1115_error_t ads1115_iio_buffer_read(ads1115_iio_t *iio, ads1115_iio_scan_t *scans, uint32_t max_scans, uint32_t *count)
+{
+    if (!iio->is_initialized)
+        return ADS1115_ERROR_NOT_INITIALIZED;
+    if (!scans || !count)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (!iio->buffer_enabled)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    uint8_t chunk[IIO_READ_CHUNK];
+    uint32_t fit = IIO_READ_CHUNK / iio->record_bytes;
+    if (max_scans > fit)
+        max_scans = fit;
+
+    *count = 0;
+    ssize_t n = read(iio->fd, chunk, (size_t)max_scans * iio->record_bytes);
+    if (n < 0)
+        return (errno == EAGAIN || errno == EWOULDBLOCK) ? ADS1115_OK : ADS1115_ERROR_I2C_READ;
+
+    uint32_t records = (uint32_t)n / iio->record_bytes;
+    for (uint32_t r = 0; r < records; r++)
+    {
+        const uint8_t *record = &chunk[r * iio->record_bytes];
+        ads1115_iio_scan_t *scan = &scans[r];
+        memset(scan, 0, sizeof(*scan));
+        scan->scan_mask = iio->scan_mask;
+        for (uint8_t ch = 0; ch < ADS1115_IIO_CHANNELS; ch++)
+        {
+            if ((iio->scan_mask & ADS1115_IIO_SCAN_BIT(ch)) == 0U)
+                continue;
+            scan->adc_raw[ch] = (int16_t)decode_element(record, &iio->elements[ch]);
+            ads1115_raw_to_voltage(iio->range[ch], scan->adc_raw[ch], &scan->voltage[ch]);
+        }
+        if (iio->timestamp)
+            scan->timestamp_ns = decode_element(record, &iio->ts_element);
+    }
+    *count = records;
+    return ADS1115_OK;
+}
+
+/** @} */ // End of ADS1115_IIO
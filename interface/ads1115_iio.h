@@ -0,0 +1,189 @@
+/**
+ * @file ads1115_iio.h
+ * @brief ADS1115 Linux IIO Buffered-Mode Backend - Interface Declarations
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ *
+ * @details Alternative backend for boards where the kernel ti-ads1015 IIO driver
+ * owns the device and userspace register access through the I2C callbacks would
+ * conflict with it. The API mirrors the handle-level driver calls (single read,
+ * range, data rate) and adds triggered-buffer capture: scan elements and buffer
+ * length are configured through sysfs and samples are read in batches from the
+ * /dev/iio:deviceN character device, so sampling runs in kernel context.
+ *
+ * All paths are supplied by the caller, so the backend can be exercised against
+ * a fake sysfs directory and a regular file standing in for the character device.
+ */
+
+#ifndef ADS1115_IIO_H
+#define ADS1115_IIO_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include "ads1115.h"
+
+/**
+ * @defgroup ADS1115_IIO Linux IIO Backend
+ * @ingroup ADS1115_Interface
+ * @brief Kernel ti-ads1015 driver access through sysfs and buffered reads.
+ * @{
+ */
+
+/** @brief Maximum length of the sysfs directory and character device paths. */
+#define ADS1115_IIO_PATH_MAX 256
+
+/** @brief Number of voltage scan elements (one per @ref ads1115_mux_t). */
+#define ADS1115_IIO_CHANNELS 8
+
+/** @brief Builds a scan mask bit for a MUX setting. */
+#define ADS1115_IIO_SCAN_BIT(mux) (1U << (mux))
+
+/**
+ * @brief Layout of one scan element inside a buffer record.
+ */
+typedef struct
+{
+    uint8_t offset;      /**< Byte offset inside the record */
+    uint8_t bytes;       /**< Storage size in bytes */
+    uint8_t shift;       /**< Right shift applied to the stored value */
+    uint8_t realbits;    /**< Significant bits */
+    bool big_endian;     /**< Storage endianness */
+    bool is_signed;      /**< Two's complement value */
+} ads1115_iio_element_t;
+
+/**
+ * @brief One decoded buffer record.
+ */
+typedef struct
+{
+    uint8_t scan_mask;                        /**< The one channel present, see @ref ADS1115_IIO_SCAN_BIT */
+    int16_t adc_raw[ADS1115_IIO_CHANNELS];    /**< Raw code, valid for the channel in @ref scan_mask */
+    float voltage[ADS1115_IIO_CHANNELS];      /**< Converted value, scaled like @ref ads1115_single_read */
+    int64_t timestamp_ns;                     /**< Kernel timestamp, 0 if not enabled */
+} ads1115_iio_scan_t;
+
+/**
+ * @brief IIO backend state.
+ */
+typedef struct
+{
+    char sysfs_dir[ADS1115_IIO_PATH_MAX];                /**< e.g. /sys/bus/iio/devices/iio:device0 */
+    char dev_path[ADS1115_IIO_PATH_MAX];                 /**< e.g. /dev/iio:device0 */
+    int fd;                                              /**< Open character device, -1 if closed */
+    ads1115_range_t range[ADS1115_IIO_CHANNELS];         /**< Range per channel (used for conversion) */
+    ads1115_data_rate_t data_rate[ADS1115_IIO_CHANNELS]; /**< Data rate per channel */
+    uint8_t scan_mask;                                   /**< Enabled scan elements */
+    bool timestamp;                                      /**< Timestamp element enabled */
+    ads1115_iio_element_t elements[ADS1115_IIO_CHANNELS]; /**< Layout of voltage elements */
+    ads1115_iio_element_t ts_element;                    /**< Layout of the timestamp element */
+    uint16_t record_bytes;                               /**< Size of one buffer record */
+    bool buffer_enabled;                                 /**< Triggered buffer running */
+    bool is_initialized;                                 /**< Internal state flag */
+} ads1115_iio_t;
+
+/**
+ * @brief Binds the backend to an IIO device directory and character device.
+ * @details Accepts a device named "ads1115", or "ads1015" (the name mainline
+ * ti-ads1015 gives every chip) whose scan elements are 16-bit unshifted, which
+ * rules out the 12-bit ADS1015. Reads back the current scale of every channel.
+ * @param iio Pointer to the backend state.
+ * @param sysfs_dir IIO device directory in sysfs.
+ * @param dev_path Matching character device.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_iio_init(ads1115_iio_t *iio, const char *sysfs_dir, const char *dev_path);
+
+/**
+ * @brief Finds the first ADS1115 under @p sysfs_root and binds to it.
+ * @details Devices are checked with @ref ads1115_iio_init.
+ * @param iio Pointer to the backend state.
+ * @param sysfs_root Usually "/sys/bus/iio/devices".
+ * @param dev_root Usually "/dev".
+ * @return ADS1115_OK, or ADS1115_ERROR_NOT_INITIALIZED if no device was found.
+ */
+ads1115_error_t ads1115_iio_find(ads1115_iio_t *iio, const char *sysfs_root, const char *dev_root);
+
+/**
+ * @brief Stops any running buffer and releases the backend.
+ * @param iio Pointer to the backend state.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_iio_deinit(ads1115_iio_t *iio);
+
+/**
+ * @brief Sets the PGA range of one channel (in_*_scale).
+ * @param iio Pointer to the backend state.
+ * @param mux Channel to configure.
+ * @param range The desired full-scale range.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_iio_set_range(ads1115_iio_t *iio, ads1115_mux_t mux, ads1115_range_t range);
+
+/**
+ * @brief Sets the data rate of one channel (in_*_sampling_frequency).
+ * @param iio Pointer to the backend state.
+ * @param mux Channel to configure.
+ * @param data_rate Samples per second selection.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_iio_set_data_rate(ads1115_iio_t *iio, ads1115_mux_t mux, ads1115_data_rate_t data_rate);
+
+/**
+ * @brief Performs a direct-mode conversion (in_*_raw).
+ * @param iio Pointer to the backend state.
+ * @param mux Channel to convert.
+ * @param[out] adc_raw Raw 16-bit signed integer output.
+ * @param[out] voltage Calculated voltage, scaled like @ref ads1115_single_read.
+ * @return ADS1115_ERROR_CONVERSION_BUSY while the buffer is enabled.
+ */
+ads1115_error_t ads1115_iio_single_read(ads1115_iio_t *iio, ads1115_mux_t mux, int16_t *adc_raw, float *voltage);
+
+/**
+ * @brief Selects the scan element captured in buffered mode.
+ * @details ti-ads1015 converts one channel per trigger and only accepts one-hot
+ * scan masks, so each buffer run captures a single channel; to sample several,
+ * stop the buffer and select the next channel between runs. Other channels are
+ * disabled before the selected one is enabled.
+ * @param iio Pointer to the backend state.
+ * @param scan_mask Exactly one bit built with @ref ADS1115_IIO_SCAN_BIT.
+ * @param timestamp true to capture the kernel timestamp as well.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_iio_set_scan_channels(ads1115_iio_t *iio, uint8_t scan_mask, bool timestamp);
+
+/**
+ * @brief Enables the triggered buffer and opens the character device.
+ * @param iio Pointer to the backend state.
+ * @param length Kernel buffer length in records.
+ * @param trigger Trigger name written to trigger/current_trigger, NULL to keep the current one.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_iio_buffer_start(ads1115_iio_t *iio, uint32_t length, const char *trigger);
+
+/**
+ * @brief Disables the triggered buffer and closes the character device.
+ * @param iio Pointer to the backend state.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_iio_buffer_stop(ads1115_iio_t *iio);
+
+/**
+ * @brief Reads and decodes up to @p max_scans records in one read() call.
+ * @param iio Pointer to the backend state.
+ * @param[out] scans Destination buffer.
+ * @param max_scans Capacity of @p scans.
+ * @param[out] count Number of records decoded (0 if none are available).
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_iio_buffer_read(ads1115_iio_t *iio, ads1115_iio_scan_t *scans, uint32_t max_scans, uint32_t *count);
+
+/** @} */ // End of ADS1115_IIO
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADS1115_IIO_H */
@@ -0,0 +1,335 @@
+/**
+ * @file ads1115_shm.c
+ * @brief ADS1115 Shared-Memory Sample Publisher - Implementation (POSIX)
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ * @details Requires a C11 compiler with lock-free 64-bit atomics and a POSIX
+ * system providing shm_open/mmap (link with -lrt on older C libraries).
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "ads1115_shm.h"
+#include <fcntl.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if ATOMIC_LLONG_LOCK_FREE != 2
+#error "ads1115_shm requires lock-free 64-bit atomics for cross-process sequencing"
+#endif
+
+/**
+ * @addtogroup ADS1115_Shm
+ * @{
+ */
+
+/*===========================================================================*/
+/* PRIVATE DEFINITIONS                                                       */
+/*===========================================================================*/
+
+#define SHM_CACHE_LINE 64U
+#define SHM_MAGIC 0x41445331U /**< "ADS1" */
+#define SHM_VERSION 1U
+
+/**
+ * @brief Ring header; the write cursor lives on its own cache line.
+ */
+typedef struct
+{
+    _Atomic uint32_t magic; /**< Written last by the publisher once the ring is ready */
+    uint32_t version;
+    uint32_t slot_count;
+    uint32_t slot_size;
+    _Atomic uint32_t generation; /**< Bumped each time a publisher (re)initialises the ring */
+    uint8_t reserved[SHM_CACHE_LINE - 20U];
+    _Atomic uint64_t head; /**< Sequence number of the next sample to be written */
+    uint8_t reserved2[SHM_CACHE_LINE - sizeof(uint64_t)];
+} shm_header_t;
+
+/**
+ * @brief One ring slot, exactly one cache line.
+ * @details @ref seq is 2n+1 while sample n is being written and 2n+2 once it is complete.
+ */
+typedef struct
+{
+    _Atomic uint64_t seq;
+    uint32_t timestamp_us;
+    float voltage;
+    int16_t adc_raw;
+    uint8_t channel;
+    uint8_t i2c_addr;
+    uint8_t mux;
+    uint8_t range;
+    uint8_t reserved[SHM_CACHE_LINE - 22U];
+} shm_slot_t;
+
+_Static_assert(sizeof(shm_header_t) == 2U * SHM_CACHE_LINE, "shm header must span two cache lines");
+_Static_assert(sizeof(shm_slot_t) == SHM_CACHE_LINE, "shm slot must be one cache line");
+
+/*===========================================================================*/
+/* PRIVATE FUNCTIONS                                                         */
+/*===========================================================================*/
+
+static shm_header_t *ring_header(const void *base)
+{
+    return (shm_header_t *)(uintptr_t)base;
+}
+
+static shm_slot_t *ring_slots(const void *base)
+{
+    return (shm_slot_t *)((uint8_t *)(uintptr_t)base + sizeof(shm_header_t));
+}
+
+/*===========================================================================*/
+/* PUBLIC API IMPLEMENTATIONS                                                */
+/*===========================================================================*/
+
+ads1115_error_t ads1115_shm_publisher_open(ads1115_shm_publisher_t *pub, const char *name, uint32_t slot_count)
+{
+    if (pub == NULL || name == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (slot_count < 2U || (slot_count & (slot_count - 1U)) != 0U || strlen(name) >= ADS1115_SHM_NAME_MAX)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    size_t size = sizeof(shm_header_t) + (size_t)slot_count * sizeof(shm_slot_t);
+    int fd = shm_open(name, O_CREAT | O_RDWR, 0644);
+    if (fd < 0)
+        return ADS1115_ERROR_INVALID_PARAM;
+    /* Readers may still map an existing object: only touch its size when it is wrong */
+    struct stat st;
+    if (fstat(fd, &st) != 0 || ((size_t)st.st_size != size && ftruncate(fd, (off_t)size) != 0))
+    {
+        close(fd);
+        return ADS1115_ERROR_INVALID_PARAM;
+    }
+    void *base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    /* Take the ring offline, start a new generation, then clear every slot to
+     * seq 0 (never valid) so samples of the previous run cannot match new cursors */
+    shm_header_t *hdr = ring_header(base);
+    atomic_store_explicit(&hdr->magic, 0, memory_order_release);
+    uint32_t generation = atomic_load_explicit(&hdr->generation, memory_order_relaxed) + 1U;
+    atomic_store_explicit(&hdr->generation, generation, memory_order_release);
+    atomic_store_explicit(&hdr->head, 0, memory_order_relaxed);
+    shm_slot_t *slots = ring_slots(base);
+    for (uint32_t i = 0; i < slot_count; i++)
+        atomic_store_explicit(&slots[i].seq, 0, memory_order_relaxed);
+    hdr->version = SHM_VERSION;
+    hdr->slot_count = slot_count;
+    hdr->slot_size = (uint32_t)sizeof(shm_slot_t);
+    atomic_store_explicit(&hdr->magic, SHM_MAGIC, memory_order_release);
+
+    pub->base = base;
+    pub->size = size;
+    pub->mask = slot_count - 1U;
+    pub->head = 0;
+    strcpy(pub->name, name);
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_shm_publisher_close(ads1115_shm_publisher_t *pub, bool unlink_object)
+{
+    if (pub == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (pub->base == NULL)
+        return ADS1115_ERROR_NOT_INITIALIZED;
+
+    atomic_store_explicit(&ring_header(pub->base)->magic, 0, memory_order_release);
+    munmap(pub->base, pub->size);
+    pub->base = NULL;
+    if (unlink_object)
+        shm_unlink(pub->name);
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_shm_publish(ads1115_shm_publisher_t *pub, const ads1115_shm_sample_t *sample)
+{
+    if (pub == NULL || sample == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (pub->base == NULL)
+        return ADS1115_ERROR_NOT_INITIALIZED;
+
+    uint64_t n = pub->head;
+    shm_slot_t *slot = &ring_slots(pub->base)[n & pub->mask];
+
+    atomic_store_explicit(&slot->seq, 2U * n + 1U, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    slot->timestamp_us = sample->timestamp_us;
+    slot->voltage = sample->voltage;
+    slot->adc_raw = sample->adc_raw;
+    slot->channel = sample->channel;
+    slot->i2c_addr = sample->i2c_addr;
+    slot->mux = sample->mux;
+    slot->range = sample->range;
+    atomic_store_explicit(&slot->seq, 2U * n + 2U, memory_order_release);
+
+    pub->head = n + 1U;
+    atomic_store_explicit(&ring_header(pub->base)->head, pub->head, memory_order_release);
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_shm_publish_handle(ads1115_shm_publisher_t *pub, const ads1115_handle_t *handle,
+                                           int16_t adc_raw, float voltage, uint32_t timestamp_us)
+{
+    if (handle == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+
+    ads1115_shm_sample_t sample = {
+        .timestamp_us = timestamp_us,
+        .voltage = voltage,
+        .adc_raw = adc_raw,
+        .channel = ADS1115_SHM_NO_CHANNEL,
+        .i2c_addr = (uint8_t)handle->i2c_addr,
+        .mux = (uint8_t)handle->config.mux,
+        .range = (uint8_t)handle->config.range};
+    return ads1115_shm_publish(pub, &sample);
+}
+
+void ads1115_shm_publish_sample(uint8_t channel_index, int16_t adc_raw, float voltage, uint32_t timestamp_us, void *user_data)
+{
+    ads1115_shm_sample_t sample = {
+        .timestamp_us = timestamp_us,
+        .voltage = voltage,
+        .adc_raw = adc_raw,
+        .channel = channel_index,
+        .i2c_addr = ADS1115_SHM_UNKNOWN,
+        .mux = ADS1115_SHM_UNKNOWN,
+        .range = ADS1115_SHM_UNKNOWN};
+    ads1115_shm_publish((ads1115_shm_publisher_t *)user_data, &sample);
+}
+
+ads1115_error_t ads1115_shm_reader_open(ads1115_shm_reader_t *reader, const char *name)
+{
+    if (reader == NULL || name == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+
+    int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0)
+        return ADS1115_ERROR_INVALID_PARAM;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(shm_header_t))
+    {
+        close(fd);
+        return ADS1115_ERROR_NOT_INITIALIZED;
+    }
+    void *base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    shm_header_t *hdr = ring_header(base);
+    ads1115_error_t err = ADS1115_OK;
+    if (atomic_load_explicit(&hdr->magic, memory_order_acquire) != SHM_MAGIC)
+        err = ADS1115_ERROR_NOT_INITIALIZED;
+    else if (hdr->version != SHM_VERSION || hdr->slot_size != sizeof(shm_slot_t) ||
+             sizeof(shm_header_t) + (size_t)hdr->slot_count * sizeof(shm_slot_t) > (size_t)st.st_size)
+        err = ADS1115_ERROR_INVALID_PARAM;
+    if (err != ADS1115_OK)
+    {
+        munmap(base, (size_t)st.st_size);
+        return err;
+    }
+
+    reader->base = base;
+    reader->size = (size_t)st.st_size;
+    reader->mask = hdr->slot_count - 1U;
+    reader->generation = atomic_load_explicit(&hdr->generation, memory_order_acquire);
+    reader->cursor = atomic_load_explicit(&hdr->head, memory_order_acquire);
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_shm_reader_close(ads1115_shm_reader_t *reader)
+{
+    if (reader == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (reader->base == NULL)
+        return ADS1115_ERROR_NOT_INITIALIZED;
+    munmap((void *)(uintptr_t)reader->base, reader->size);
+    reader->base = NULL;
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_shm_read(ads1115_shm_reader_t *reader, ads1115_shm_sample_t *samples, uint32_t max_samples,
+                                 uint32_t *count, uint64_t *lost)
+{
+    if (reader == NULL || samples == NULL || count == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (reader->base == NULL)
+        return ADS1115_ERROR_NOT_INITIALIZED;
+
+    shm_header_t *hdr = ring_header(reader->base);
+    shm_slot_t *slots = ring_slots(reader->base);
+    uint64_t slot_count = (uint64_t)reader->mask + 1U;
+    uint64_t missed = 0;
+    uint32_t n = 0;
+
+    /* Generation before magic: a new generation is only trusted once its ring is ready */
+    uint32_t generation = atomic_load_explicit(&hdr->generation, memory_order_acquire);
+    if (generation != reader->generation)
+    {
+        *count = 0;
+        if (lost)
+            *lost = 0;
+        if (atomic_load_explicit(&hdr->magic, memory_order_acquire) != SHM_MAGIC)
+            return ADS1115_OK;
+        if (hdr->slot_count != slot_count)
+            return ADS1115_ERROR_NOT_INITIALIZED;
+        reader->generation = generation;
+        reader->cursor = 0;
+    }
+
+    uint64_t head = atomic_load_explicit(&hdr->head, memory_order_acquire);
+    if (reader->cursor > head)
+        reader->cursor = head; /* Raced with a reinitialisation; the next call moves to its generation */
+    while (n < max_samples && reader->cursor < head)
+    {
+        if (head - reader->cursor > slot_count)
+        {
+            missed += head - slot_count - reader->cursor;
+            reader->cursor = head - slot_count;
+        }
+
+        const shm_slot_t *slot = &slots[reader->cursor & reader->mask];
+        uint64_t expected = 2U * reader->cursor + 2U;
+        uint64_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        if (seq == expected)
+        {
+            ads1115_shm_sample_t *out = &samples[n];
+            const volatile shm_slot_t *vslot = slot;
+            out->sequence = reader->cursor;
+            out->timestamp_us = vslot->timestamp_us;
+            out->voltage = vslot->voltage;
+            out->adc_raw = vslot->adc_raw;
+            out->channel = vslot->channel;
+            out->i2c_addr = vslot->i2c_addr;
+            out->mux = vslot->mux;
+            out->range = vslot->range;
+            atomic_thread_fence(memory_order_acquire);
+            if (atomic_load_explicit(&slot->seq, memory_order_relaxed) == expected)
+            {
+                n++;
+                reader->cursor++;
+                continue;
+            }
+        }
+
+        /* The slot was recycled while we looked at it: resynchronise on the newest head */
+        missed++;
+        reader->cursor++;
+        head = atomic_load_explicit(&hdr->head, memory_order_acquire);
+    }
+
+    *count = n;
+    if (lost)
+        *lost = missed;
+    return ADS1115_OK;
+}
+
+/** @} */ // End of ADS1115_Shm
@@ -0,0 +1,180 @@
+/**
+ * @file ads1115_shm.h
+ * @brief ADS1115 Shared-Memory Sample Publisher - Interface Declarations
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ *
+ * @details POSIX shared-memory ring that lets one acquisition process feed any
+ * number of consumer processes. The publisher writes every sample into a
+ * cache-line sized slot guarded by a per-slot sequence number; readers attach
+ * read-only, never take a lock, never issue a syscall per sample and detect
+ * overruns on their own by comparing sequence numbers.
+ *
+ * The publish callback has the same signature as @ref ads1115_sched_sample_t and
+ * @ref ads1115_monitor_excursion_t, so a publisher can be passed directly as the
+ * sample callback (with the publisher as @p user_data).
+ */
+
+#ifndef ADS1115_SHM_H
+#define ADS1115_SHM_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include "ads1115.h"
+#include <stddef.h>
+
+/**
+ * @defgroup ADS1115_Shm Shared-Memory Publisher
+ * @ingroup ADS1115_Interface
+ * @brief Zero-lock sample distribution to multiple consumer processes.
+ * @{
+ */
+
+/** @brief Maximum length of the shared-memory object name, including the leading '/'. */
+#define ADS1115_SHM_NAME_MAX 64
+
+/** @brief Channel value used when a sample is not tied to a scheduler/monitor channel. */
+#define ADS1115_SHM_NO_CHANNEL 0xFF
+
+/**
+ * @brief Address, MUX and range value used when the publisher does not know them.
+ * @details Never a valid 7-bit address, @ref ads1115_mux_t or @ref ads1115_range_t.
+ * Samples published through @ref ads1115_shm_publish_sample carry it.
+ */
+#define ADS1115_SHM_UNKNOWN 0xFF
+
+/**
+ * @brief One published sample as seen by readers.
+ */
+typedef struct
+{
+    uint64_t sequence;     /**< Monotonic sample number assigned by the publisher */
+    uint32_t timestamp_us; /**< Acquisition timestamp */
+    float voltage;         /**< Converted voltage in millivolts */
+    int16_t adc_raw;       /**< Raw conversion result */
+    uint8_t channel;       /**< Scheduler/monitor channel index or @ref ADS1115_SHM_NO_CHANNEL */
+    uint8_t i2c_addr;      /**< Device address or @ref ADS1115_SHM_UNKNOWN */
+    uint8_t mux;           /**< @ref ads1115_mux_t of the sample or @ref ADS1115_SHM_UNKNOWN */
+    uint8_t range;         /**< @ref ads1115_range_t of the sample or @ref ADS1115_SHM_UNKNOWN */
+} ads1115_shm_sample_t;
+
+/**
+ * @brief Publisher side of a ring (single writer).
+ */
+typedef struct
+{
+    void *base;                      /**< Mapping base address */
+    size_t size;                     /**< Mapping size in bytes */
+    uint32_t mask;                   /**< Slot count minus one */
+    uint64_t head;                   /**< Next sequence number to publish */
+    char name[ADS1115_SHM_NAME_MAX]; /**< Shared-memory object name */
+} ads1115_shm_publisher_t;
+
+/**
+ * @brief Reader side of a ring; each reader keeps its own cursor.
+ */
+typedef struct
+{
+    const void *base;    /**< Mapping base address */
+    size_t size;         /**< Mapping size in bytes */
+    uint32_t mask;       /**< Slot count minus one */
+    uint32_t generation; /**< Publisher generation @ref cursor belongs to */
+    uint64_t cursor;     /**< Next sequence number this reader expects */
+} ads1115_shm_reader_t;
+
+/**
+ * @brief Creates the shared-memory ring, or reinitialises an existing one in place.
+ * @details An existing object is resized only when its size does not match
+ * @p slot_count, so readers still mapping it are not cut short. Reinitialising
+ * starts a new generation at sequence number 0; attached readers notice it on
+ * their next @ref ads1115_shm_read and restart from the new samples.
+ * @param pub Pointer to the publisher.
+ * @param name POSIX shared-memory name, e.g. "/ads1115".
+ * @param slot_count Number of slots, must be a power of two.
+ * @return ADS1115_OK, or ADS1115_ERROR_INVALID_PARAM if the object cannot be created or mapped (errno holds the cause).
+ */
+ads1115_error_t ads1115_shm_publisher_open(ads1115_shm_publisher_t *pub, const char *name, uint32_t slot_count);
+
+/**
+ * @brief Unmaps the ring and optionally removes the shared-memory object.
+ * @param pub Pointer to the publisher.
+ * @param unlink_object true to shm_unlink the object.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_shm_publisher_close(ads1115_shm_publisher_t *pub, bool unlink_object);
+
+/**
+ * @brief Publishes one sample; the sequence field of @p sample is ignored.
+ * @param pub Pointer to the publisher.
+ * @param sample Sample to publish.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_shm_publish(ads1115_shm_publisher_t *pub, const ads1115_shm_sample_t *sample);
+
+/**
+ * @brief Publishes a result read through a driver handle.
+ * @details Address, MUX and range are taken from the handle configuration, so call
+ * it right after @ref ads1115_single_read, @ref ads1115_single_collect or
+ * @ref ads1115_continuous_conversion_read.
+ * @param pub Pointer to the publisher.
+ * @param handle Handle the result was read from.
+ * @param adc_raw Raw conversion result.
+ * @param voltage Converted voltage, scaled like @ref ads1115_single_read.
+ * @param timestamp_us Acquisition timestamp.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_shm_publish_handle(ads1115_shm_publisher_t *pub, const ads1115_handle_t *handle,
+                                           int16_t adc_raw, float voltage, uint32_t timestamp_us);
+
+/**
+ * @brief Sample callback adapter; @p user_data must point to an open publisher.
+ * @details Suitable as @ref ads1115_sched_sample_t or @ref ads1115_monitor_excursion_t.
+ * The callbacks carry no handle, so address, MUX and range are published as
+ * @ref ADS1115_SHM_UNKNOWN; use @ref ads1115_shm_publish_handle when they matter.
+ */
+void ads1115_shm_publish_sample(uint8_t channel_index, int16_t adc_raw, float voltage, uint32_t timestamp_us, void *user_data);
+
+/**
+ * @brief Attaches read-only to an existing ring, positioned at the newest sample.
+ * @param reader Pointer to the reader.
+ * @param name POSIX shared-memory name used by the publisher.
+ * @return ADS1115_OK, ADS1115_ERROR_NOT_INITIALIZED if the ring is not ready, or
+ * ADS1115_ERROR_INVALID_PARAM if it cannot be opened or has an unexpected layout.
+ */
+ads1115_error_t ads1115_shm_reader_open(ads1115_shm_reader_t *reader, const char *name);
+
+/**
+ * @brief Detaches a reader.
+ * @param reader Pointer to the reader.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_shm_reader_close(ads1115_shm_reader_t *reader);
+
+/**
+ * @brief Reads up to @p max_samples new samples without blocking.
+ * @details Samples overwritten before the reader got to them are skipped and
+ * counted in @p lost; the reader then continues with the oldest sample still valid.
+ * When the publisher has reinitialised the ring the reader moves to the new
+ * generation (unread samples of the old one are not counted as lost); while the
+ * ring is being reinitialised no samples are returned.
+ * @param reader Pointer to the reader.
+ * @param[out] samples Destination buffer.
+ * @param max_samples Capacity of @p samples.
+ * @param[out] count Number of samples stored.
+ * @param[out] lost Number of samples missed since the previous call (may be NULL).
+ * @return ADS1115_ERROR_NOT_INITIALIZED if the ring was recreated with another
+ * slot count (reopen the reader), otherwise @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_shm_read(ads1115_shm_reader_t *reader, ads1115_shm_sample_t *samples, uint32_t max_samples,
+                                 uint32_t *count, uint64_t *lost);
+
+/** @} */ // End of ADS1115_Shm
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADS1115_SHM_H */
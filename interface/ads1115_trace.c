@@ -0,0 +1,383 @@
+/**
+ * @file ads1115_trace.c
+ * @brief ADS1115 I2C Transaction Trace Record/Replay - Implementation
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ */
+
+#include "ads1115_trace.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @addtogroup ADS1115_Trace
+ * @{
+ */
+
+/*===========================================================================*/
+/* PRIVATE DEFINITIONS                                                       */
+/*===========================================================================*/
+
+#define TRACE_KIND_WRITE 1U
+#define TRACE_KIND_READ 2U
+#define TRACE_KIND_DELAY 3U
+#define TRACE_KIND_MASK 0x03U
+#define TRACE_FLAG_OK 0x04U
+
+/** @brief File header: magic "A115", version, three reserved bytes, record length (LE) */
+#define TRACE_FILE_MAGIC "A115"
+#define TRACE_FILE_VERSION 1U
+#define TRACE_FILE_HEADER_SIZE 12U
+
+/** @brief Largest possible record: kind, three 5-byte varints, addr, reg, len, 255 payload bytes */
+#define TRACE_MAX_RECORD (1U + 3U * 5U + 3U + 255U)
+
+/** @brief The trace serviced by the context-free callbacks */
+static ads1115_trace_t *active_trace = NULL;
+
+/**
+ * @brief Decoded record header.
+ */
+typedef struct
+{
+    uint8_t kind;
+    bool ok;
+    uint32_t delta_us;
+    uint32_t duration_us;
+    uint8_t addr;
+    uint8_t reg;
+    uint8_t len;
+    const uint8_t *payload;
+    uint32_t delay_ms;
+} trace_record_t;
+
+/*===========================================================================*/
+/* PRIVATE FUNCTIONS                                                         */
+/*===========================================================================*/
+
+static uint32_t put_varint(uint8_t *out, uint32_t value)
+{
+    uint32_t n = 0;
+    while (value >= 0x80U)
+    {
+        out[n++] = (uint8_t)(value | 0x80U);
+        value >>= 7;
+    }
+    out[n++] = (uint8_t)value;
+    return n;
+}
+
+static bool get_varint(const uint8_t *buf, uint32_t length, uint32_t *pos, uint32_t *value)
+{
+    uint32_t result = 0;
+    for (uint32_t shift = 0; shift < 35U; shift += 7U)
+    {
+        if (*pos >= length)
+            return false;
+        uint8_t byte = buf[(*pos)++];
+        result |= (uint32_t)(byte & 0x7FU) << shift;
+        if ((byte & 0x80U) == 0U)
+        {
+            *value = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Decodes the record at @p *pos and advances past it.
+ */
+static bool decode_record(const uint8_t *buf, uint32_t length, uint32_t *pos, trace_record_t *rec)
+{
+    if (*pos >= length)
+        return false;
+    uint8_t head = buf[(*pos)++];
+    rec->kind = head & TRACE_KIND_MASK;
+    rec->ok = (head & TRACE_FLAG_OK) != 0U;
+    if (rec->kind == 0U)
+        return false;
+    if (!get_varint(buf, length, pos, &rec->delta_us) || !get_varint(buf, length, pos, &rec->duration_us))
+        return false;
+
+    if (rec->kind == TRACE_KIND_DELAY)
+        return get_varint(buf, length, pos, &rec->delay_ms);
+
+    if (*pos + 3U > length)
+        return false;
+    rec->addr = buf[(*pos)++];
+    rec->reg = buf[(*pos)++];
+    rec->len = buf[(*pos)++];
+    if (*pos + rec->len > length)
+        return false;
+    rec->payload = &buf[*pos];
+    *pos += rec->len;
+    return true;
+}
+
+/**
+ * @brief Appends one record while recording.
+ */
+static void append_record(ads1115_trace_t *trace, uint8_t kind, bool ok, uint32_t start_us, uint32_t end_us,
+                          uint8_t addr, uint8_t reg, const uint8_t *payload, uint8_t len, uint32_t delay_ms)
+{
+    uint8_t rec[TRACE_MAX_RECORD];
+    uint32_t n = 0;
+
+    /* Keep the trace a gap-free prefix: nothing is appended after the first loss */
+    if (trace->overflow)
+        return;
+    rec[n++] = (uint8_t)(kind | (ok ? TRACE_FLAG_OK : 0U));
+    n += put_varint(&rec[n], start_us - trace->last_start_us);
+    n += put_varint(&rec[n], end_us - start_us);
+    if (kind == TRACE_KIND_DELAY)
+    {
+        n += put_varint(&rec[n], delay_ms);
+    }
+    else
+    {
+        rec[n++] = addr;
+        rec[n++] = reg;
+        rec[n++] = len;
+        if (len > 0U)
+            memcpy(&rec[n], payload, len);
+        n += len;
+    }
+
+    if (trace->length + n > trace->capacity)
+    {
+        trace->overflow = true;
+        return;
+    }
+    memcpy(&trace->buffer[trace->length], rec, n);
+    trace->length += n;
+    trace->last_start_us = start_us;
+    trace->now_us = end_us;
+}
+
+/**
+ * @brief Fetches the next replay record, advancing the virtual clock.
+ */
+static bool next_record(ads1115_trace_t *trace, trace_record_t *rec)
+{
+    if (!decode_record(trace->buffer, trace->length, &trace->position, rec))
+    {
+        trace->position = trace->length;
+        return false;
+    }
+    trace->last_start_us += rec->delta_us;
+    trace->now_us = trace->last_start_us + rec->duration_us;
+    return true;
+}
+
+/*===========================================================================*/
+/* PUBLIC API IMPLEMENTATIONS                                                */
+/*===========================================================================*/
+
+ads1115_error_t ads1115_trace_record_start(ads1115_trace_t *trace, uint8_t *buffer, uint32_t capacity,
+                                           ads1115_i2c_write_t i2c_write, ads1115_i2c_read_t i2c_read,
+                                           ads1115_delay_ms_t delay_ms, ads1115_trace_clock_t clock_us)
+{
+    if (trace == NULL || buffer == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (!i2c_write || !i2c_read || !delay_ms || !clock_us)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    memset(trace, 0, sizeof(*trace));
+    trace->buffer = buffer;
+    trace->capacity = capacity;
+    trace->i2c_write = i2c_write;
+    trace->i2c_read = i2c_read;
+    trace->delay_ms = delay_ms;
+    trace->clock_us = clock_us;
+    trace->last_start_us = clock_us();
+    trace->now_us = trace->last_start_us;
+    trace->mode = ADS1115_TRACE_RECORD;
+    active_trace = trace;
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_trace_replay_start(ads1115_trace_t *trace, uint8_t *buffer, uint32_t length)
+{
+    if (trace == NULL || buffer == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+
+    memset(trace, 0, sizeof(*trace));
+    trace->buffer = buffer;
+    trace->capacity = length;
+    trace->length = length;
+    trace->mode = ADS1115_TRACE_REPLAY;
+    active_trace = trace;
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_trace_stop(ads1115_trace_t *trace)
+{
+    if (trace == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    trace->mode = ADS1115_TRACE_IDLE;
+    if (active_trace == trace)
+        active_trace = NULL;
+    return ADS1115_OK;
+}
+
+bool ads1115_trace_i2c_write(uint8_t device_addr, uint8_t reg_addr, const uint8_t *data, uint8_t length)
+{
+    ads1115_trace_t *trace = active_trace;
+    if (trace == NULL)
+        return false;
+
+    if (trace->mode == ADS1115_TRACE_RECORD)
+    {
+        uint32_t start = trace->clock_us();
+        bool ok = trace->i2c_write(device_addr, reg_addr, data, length);
+        append_record(trace, TRACE_KIND_WRITE, ok, start, trace->clock_us(), device_addr, reg_addr, data, length, 0);
+        return ok;
+    }
+
+    trace_record_t rec;
+    if (!next_record(trace, &rec) || rec.kind != TRACE_KIND_WRITE || rec.addr != device_addr ||
+        rec.reg != reg_addr || rec.len != length)
+    {
+        trace->mismatches++;
+        return false;
+    }
+    if (memcmp(rec.payload, data, length) != 0)
+        trace->mismatches++;
+    return rec.ok;
+}
+
+bool ads1115_trace_i2c_read(uint8_t device_addr, uint8_t reg_addr, uint8_t *data, uint8_t length)
+{
+    ads1115_trace_t *trace = active_trace;
+    if (trace == NULL)
+        return false;
+
+    if (trace->mode == ADS1115_TRACE_RECORD)
+    {
+        uint32_t start = trace->clock_us();
+        bool ok = trace->i2c_read(device_addr, reg_addr, data, length);
+        append_record(trace, TRACE_KIND_READ, ok, start, trace->clock_us(), device_addr, reg_addr, data, length, 0);
+        return ok;
+    }
+
+    trace_record_t rec;
+    if (!next_record(trace, &rec) || rec.kind != TRACE_KIND_READ || rec.addr != device_addr ||
+        rec.reg != reg_addr || rec.len != length)
+    {
+        trace->mismatches++;
+        return false;
+    }
+    memcpy(data, rec.payload, length);
+    return rec.ok;
+}
+
+void ads1115_trace_delay_ms(uint32_t milliseconds)
+{
+    ads1115_trace_t *trace = active_trace;
+    if (trace == NULL)
+        return;
+
+    if (trace->mode == ADS1115_TRACE_RECORD)
+    {
+        uint32_t start = trace->clock_us();
+        trace->delay_ms(milliseconds);
+        append_record(trace, TRACE_KIND_DELAY, true, start, trace->clock_us(), 0, 0, NULL, 0, milliseconds);
+        return;
+    }
+
+    trace_record_t rec;
+    if (!next_record(trace, &rec) || rec.kind != TRACE_KIND_DELAY || rec.delay_ms != milliseconds)
+        trace->mismatches++;
+}
+
+uint32_t ads1115_trace_now_us(void)
+{
+    ads1115_trace_t *trace = active_trace;
+    if (trace == NULL)
+        return 0;
+    return trace->mode == ADS1115_TRACE_RECORD ? trace->clock_us() : trace->now_us;
+}
+
+ads1115_error_t ads1115_trace_summarize(const uint8_t *buffer, uint32_t length, ads1115_trace_stats_t *stats)
+{
+    if (buffer == NULL || stats == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+
+    memset(stats, 0, sizeof(*stats));
+    uint32_t pos = 0;
+    uint64_t start = 0;
+    trace_record_t rec;
+    while (pos < length)
+    {
+        if (!decode_record(buffer, length, &pos, &rec))
+            return ADS1115_ERROR_INVALID_PARAM;
+        start += rec.delta_us;
+        stats->span_us = start + rec.duration_us;
+
+        if (rec.kind == TRACE_KIND_DELAY)
+        {
+            stats->delays++;
+            stats->delay_ms += rec.delay_ms;
+            continue;
+        }
+        if (rec.kind == TRACE_KIND_WRITE)
+            stats->writes++;
+        else
+            stats->reads++;
+        if (!rec.ok)
+            stats->failures++;
+        stats->bus_time_us += rec.duration_us;
+    }
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_trace_save(const ads1115_trace_t *trace, const char *path)
+{
+    if (trace == NULL || path == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+
+    uint8_t header[TRACE_FILE_HEADER_SIZE] = {0};
+    memcpy(header, TRACE_FILE_MAGIC, 4);
+    header[4] = TRACE_FILE_VERSION;
+    for (uint32_t i = 0; i < 4U; i++)
+        header[8U + i] = (uint8_t)(trace->length >> (8U * i));
+
+    FILE *f = fopen(path, "wb");
+    if (f == NULL)
+        return ADS1115_ERROR_INVALID_PARAM;
+    bool ok = fwrite(header, 1, sizeof(header), f) == sizeof(header) &&
+              fwrite(trace->buffer, 1, trace->length, f) == trace->length;
+    if (fclose(f) != 0)
+        ok = false;
+    return ok ? ADS1115_OK : ADS1115_ERROR_INVALID_PARAM;
+}
+
+ads1115_error_t ads1115_trace_load(const char *path, uint8_t *buffer, uint32_t capacity, uint32_t *length)
+{
+    if (path == NULL || buffer == NULL || length == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+
+    FILE *f = fopen(path, "rb");
+    if (f == NULL)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    uint8_t header[TRACE_FILE_HEADER_SIZE];
+    uint32_t records = 0;
+    bool ok = fread(header, 1, sizeof(header), f) == sizeof(header) &&
+              memcmp(header, TRACE_FILE_MAGIC, 4) == 0 && header[4] == TRACE_FILE_VERSION;
+    if (ok)
+    {
+        for (uint32_t i = 0; i < 4U; i++)
+            records |= (uint32_t)header[8U + i] << (8U * i);
+        ok = records <= capacity && fread(buffer, 1, records, f) == records;
+    }
+    fclose(f);
+    if (!ok)
+        return ADS1115_ERROR_INVALID_PARAM;
+    *length = records;
+    return ADS1115_OK;
+}
+
+/** @} */ // End of ADS1115_Trace
@@ -0,0 +1,181 @@
+/**
+ * @file ads1115_trace.h
+ * @brief ADS1115 I2C Transaction Trace Record/Replay - Interface Declarations
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ *
+ * @details A recording shim sits between the driver handle and the platform
+ * callbacks and logs every I2C read, I2C write and delay with its timestamp,
+ * duration, payload and result into a compact binary trace. The same callbacks in
+ * replay mode feed a trace back into the driver deterministically, including NAKs
+ * and a virtual clock, so field captures can be re-run and compared offline.
+ *
+ * Because @ref ads1115_i2c_write_t and friends carry no context pointer, only one
+ * trace can be active at a time. The active trace is a global without locking,
+ * so it is not thread-safe: record or replay from a single thread only. A shared
+ * bus (@ref ads1115_handle_t::bus) does not serialise it, because the conversion
+ * delay runs outside the bus claim.
+ *
+ * Record layout (all integers are unsigned LEB128 varints unless noted):
+ * - 1 byte: kind (bits 0-1: 1 = write, 2 = read, 3 = delay), bit 2 set on success
+ * - start time delta to the previous record, in microseconds
+ * - duration in microseconds
+ * - write/read: 1 byte address, 1 byte register, 1 byte length, then the payload
+ * - delay: requested milliseconds
+ */
+
+#ifndef ADS1115_TRACE_H
+#define ADS1115_TRACE_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include "ads1115.h"
+
+/**
+ * @defgroup ADS1115_Trace Trace Record/Replay
+ * @ingroup ADS1115_Interface
+ * @brief Deterministic capture and playback of bus activity.
+ * @{
+ */
+
+/**
+ * @brief Microsecond clock used to timestamp recorded transactions.
+ */
+typedef uint32_t (*ads1115_trace_clock_t)(void);
+
+/**
+ * @brief Trace operating mode.
+ */
+typedef enum
+{
+    ADS1115_TRACE_IDLE = 0,   /**< Callbacks fail, nothing is recorded */
+    ADS1115_TRACE_RECORD = 1, /**< Forward to the platform callbacks and log */
+    ADS1115_TRACE_REPLAY = 2, /**< Serve transactions from the trace */
+} ads1115_trace_mode_t;
+
+/**
+ * @brief Trace state.
+ */
+typedef struct
+{
+    uint8_t *buffer;                 /**< Record storage */
+    uint32_t capacity;               /**< Size of @ref buffer */
+    uint32_t length;                 /**< Bytes of valid records */
+    uint32_t position;               /**< Replay read position */
+    ads1115_trace_mode_t mode;       /**< Current mode */
+    ads1115_i2c_write_t i2c_write;   /**< Platform write used while recording */
+    ads1115_i2c_read_t i2c_read;     /**< Platform read used while recording */
+    ads1115_delay_ms_t delay_ms;     /**< Platform delay used while recording */
+    ads1115_trace_clock_t clock_us;  /**< Platform clock used while recording */
+    uint32_t last_start_us;          /**< Start time of the previous record */
+    uint32_t now_us;                 /**< End time of the previous record (virtual clock in replay) */
+    uint32_t mismatches;             /**< Replay calls that diverged from the trace */
+    bool overflow;                   /**< Set if recording ran out of buffer space; later records are dropped */
+} ads1115_trace_t;
+
+/**
+ * @brief Summary of a trace used to compare runs.
+ */
+typedef struct
+{
+    uint32_t writes;       /**< I2C write transactions */
+    uint32_t reads;        /**< I2C read transactions */
+    uint32_t delays;       /**< Delay calls */
+    uint32_t failures;     /**< Transactions that returned false (NAK, bus error) */
+    uint64_t bus_time_us;  /**< Sum of I2C transaction durations */
+    uint64_t delay_ms;     /**< Sum of requested delays */
+    uint64_t span_us;      /**< Time from the first record start to the last record end */
+} ads1115_trace_stats_t;
+
+/**
+ * @brief Starts recording; assign the ads1115_trace_* callbacks to the handle.
+ * @param trace Pointer to the trace.
+ * @param buffer Record storage.
+ * @param capacity Size of @p buffer in bytes.
+ * @param i2c_write Platform I2C write.
+ * @param i2c_read Platform I2C read.
+ * @param delay_ms Platform delay.
+ * @param clock_us Platform microsecond clock.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_trace_record_start(ads1115_trace_t *trace, uint8_t *buffer, uint32_t capacity,
+                                           ads1115_i2c_write_t i2c_write, ads1115_i2c_read_t i2c_read,
+                                           ads1115_delay_ms_t delay_ms, ads1115_trace_clock_t clock_us);
+
+/**
+ * @brief Starts replaying @p length bytes of records from @p buffer.
+ * @param trace Pointer to the trace.
+ * @param buffer Records to replay.
+ * @param length Number of valid bytes in @p buffer.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_trace_replay_start(ads1115_trace_t *trace, uint8_t *buffer, uint32_t length);
+
+/**
+ * @brief Deactivates the trace; the recorded length stays available.
+ * @param trace Pointer to the trace.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_trace_stop(ads1115_trace_t *trace);
+
+/**
+ * @brief Tracing I2C write callback (@ref ads1115_i2c_write_t).
+ */
+bool ads1115_trace_i2c_write(uint8_t device_addr, uint8_t reg_addr, const uint8_t *data, uint8_t length);
+
+/**
+ * @brief Tracing I2C read callback (@ref ads1115_i2c_read_t).
+ */
+bool ads1115_trace_i2c_read(uint8_t device_addr, uint8_t reg_addr, uint8_t *data, uint8_t length);
+
+/**
+ * @brief Tracing delay callback (@ref ads1115_delay_ms_t); does not sleep in replay.
+ */
+void ads1115_trace_delay_ms(uint32_t milliseconds);
+
+/**
+ * @brief Current time of the active trace.
+ * @details Returns the platform clock while recording and the deterministic
+ * virtual clock while replaying, so timing-driven code (scheduler, monitor)
+ * can be driven from it in both modes.
+ * @return Time in microseconds, 0 when no trace is active.
+ */
+uint32_t ads1115_trace_now_us(void);
+
+/**
+ * @brief Computes transaction counts and timing totals of a trace.
+ * @param buffer Records.
+ * @param length Number of valid bytes.
+ * @param[out] stats Pointer to store the summary.
+ * @return ADS1115_OK, or ADS1115_ERROR_INVALID_PARAM for a malformed trace.
+ */
+ads1115_error_t ads1115_trace_summarize(const uint8_t *buffer, uint32_t length, ads1115_trace_stats_t *stats);
+
+/**
+ * @brief Writes the recorded trace to a file with a small header.
+ * @param trace Pointer to the trace.
+ * @param path Destination file.
+ * @return ADS1115_OK, or ADS1115_ERROR_INVALID_PARAM if the file cannot be written.
+ */
+ads1115_error_t ads1115_trace_save(const ads1115_trace_t *trace, const char *path);
+
+/**
+ * @brief Loads a trace file into @p buffer, ready for @ref ads1115_trace_replay_start.
+ * @param path Source file.
+ * @param buffer Destination storage.
+ * @param capacity Size of @p buffer.
+ * @param[out] length Number of record bytes loaded.
+ * @return ADS1115_OK, or ADS1115_ERROR_INVALID_PARAM for a missing, malformed or too large file.
+ */
+ads1115_error_t ads1115_trace_load(const char *path, uint8_t *buffer, uint32_t capacity, uint32_t *length);
+
+/** @} */ // End of ADS1115_Trace
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADS1115_TRACE_H */
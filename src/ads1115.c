@@ -7,6 +7,7 @@
  */
 
 #include "ads1115.h"
+#include "ads1115_bus.h"
 #include <stddef.h>
 
 /**
@@ -78,10 +79,45 @@ static const uint16_t ADS1115_FSR_VALUES[] = {6144, 4096, 2048, 1024, 512, 256};
 static const uint32_t ADS1115_CONV_TIME_US[] = {
     125000, 62500, 31250, 15625, 7813, 4000, 2106, 1163};
 
+/** @brief Internal oscillator tolerance applied to nominal data rates, in percent */
+#define ADS1115_OSC_TOLERANCE_PCT 10U
+
+/** @brief Datasheet RMS noise in microvolts for each @ref ads1115_range_t (one LSB) */
+static const float ADS1115_NOISE_RMS_UV[] = {187.5f, 125.0f, 62.5f, 31.25f, 15.62f, 7.81f};
+
+/** @brief Datasheet peak-to-peak noise in microvolts, indexed [data_rate][range] */
+static const float ADS1115_NOISE_PP_UV[][6] = {
+    {187.5f, 125.0f, 62.5f, 31.25f, 15.62f, 7.81f},
+    {187.5f, 125.0f, 62.5f, 31.25f, 15.62f, 7.81f},
+    {187.5f, 125.0f, 62.5f, 31.25f, 15.62f, 7.81f},
+    {187.5f, 125.0f, 62.5f, 31.25f, 15.62f, 7.81f},
+    {187.5f, 125.0f, 62.5f, 31.25f, 15.62f, 12.35f},
+    {252.09f, 148.28f, 84.03f, 39.54f, 16.06f, 18.53f},
+    {266.92f, 227.38f, 79.08f, 56.84f, 32.13f, 25.95f},
+    {430.06f, 266.93f, 118.63f, 64.26f, 40.78f, 35.83f}};
+
 /*===========================================================================*/
 /* PRIVATE FUNCTIONS                                                         */
 /*===========================================================================*/
 
+/**
+ * @brief Claims the shared bus for one driver operation (no-op without a bus).
+ */
+static void bus_acquire(ads1115_handle_t *handle)
+{
+    if (handle->bus)
+        handle->bus->acquire(handle->bus, handle->bus_priority);
+}
+
+/**
+ * @brief Releases the shared bus after a driver operation.
+ */
+static void bus_release(ads1115_handle_t *handle)
+{
+    if (handle->bus)
+        handle->bus->release(handle->bus);
+}
+
 /**
  * @brief Writes a 16-bit value to an ADS1115 register.
  * @details Handles Big-Endian conversion required by the ADS1115 hardware.
@@ -117,6 +153,28 @@ static ads1115_error_t read_register(ads1115_handle_t *handle, uint8_t reg_addr,
     return ADS1115_OK;
 }
 
+/**
+ * @brief @ref write_register as one arbitrated bus operation.
+ */
+static ads1115_error_t write_register_locked(ads1115_handle_t *handle, uint8_t reg_addr, uint16_t value)
+{
+    bus_acquire(handle);
+    ads1115_error_t err = write_register(handle, reg_addr, value);
+    bus_release(handle);
+    return err;
+}
+
+/**
+ * @brief @ref read_register as one arbitrated bus operation.
+ */
+static ads1115_error_t read_register_locked(ads1115_handle_t *handle, uint8_t reg_addr, uint16_t *value)
+{
+    bus_acquire(handle);
+    ads1115_error_t err = read_register(handle, reg_addr, value);
+    bus_release(handle);
+    return err;
+}
+
 /**
  * @brief Builds the 16-bit configuration word from the handle structure.
  * @param config Pointer to configuration struct.
@@ -141,7 +199,7 @@ static uint16_t build_config_register(const ads1115_config_t *config)
  */
 static ads1115_error_t update_config_register(ads1115_handle_t *handle)
 {
-    return write_register(handle, ADS1115_REG_CONFIG, build_config_register(&handle->config));
+    return write_register_locked(handle, ADS1115_REG_CONFIG, build_config_register(&handle->config));
 }
 
 /**
@@ -171,12 +229,14 @@ ads1115_error_t ads1115_init(ads1115_handle_t *handle)
     if (!handle->i2c_read || !handle->i2c_write || !handle->delay_ms)
         return ADS1115_ERROR_INVALID_PARAM;
 
-    ads1115_error_t err;
-    if ((err = update_config_register(handle)) != ADS1115_OK)
-        return err;
-    if ((err = write_register(handle, ADS1115_REG_LO_THRESH, (uint16_t)handle->config.low_threshold)) != ADS1115_OK)
-        return err;
-    if ((err = write_register(handle, ADS1115_REG_HI_THRESH, (uint16_t)handle->config.high_threshold)) != ADS1115_OK)
+    bus_acquire(handle);
+    ads1115_error_t err = write_register(handle, ADS1115_REG_CONFIG, build_config_register(&handle->config));
+    if (err == ADS1115_OK)
+        err = write_register(handle, ADS1115_REG_LO_THRESH, (uint16_t)handle->config.low_threshold);
+    if (err == ADS1115_OK)
+        err = write_register(handle, ADS1115_REG_HI_THRESH, (uint16_t)handle->config.high_threshold);
+    bus_release(handle);
+    if (err != ADS1115_OK)
         return err;
 
     handle->is_initialized = true;
@@ -209,7 +269,7 @@ ads1115_error_t ads1115_get_range(ads1115_handle_t *handle, ads1115_range_t *ran
     if (range == NULL)
         return ADS1115_ERROR_NULL_POINTER;
     uint16_t reg;
-    ads1115_error_t err = read_register(handle, ADS1115_REG_CONFIG, &reg);
+    ads1115_error_t err = read_register_locked(handle, ADS1115_REG_CONFIG, &reg);
     if (err == ADS1115_OK)
         *range = (ads1115_range_t)((reg & ADS1115_PGA_MASK) >> ADS1115_PGA_SHIFT);
     return err;
@@ -250,7 +310,7 @@ ads1115_error_t ads1115_continuous_conversion_read(ads1115_handle_t *handle, int
     if (!adc_raw || !voltage)
         return ADS1115_ERROR_NULL_POINTER;
     uint16_t raw;
-    ads1115_error_t err = read_register(handle, ADS1115_REG_CONVERSION, &raw);
+    ads1115_error_t err = read_register_locked(handle, ADS1115_REG_CONVERSION, &raw);
     if (err == ADS1115_OK)
     {
         *adc_raw = (int16_t)raw;
@@ -267,20 +327,45 @@ ads1115_error_t ads1115_single_read(ads1115_handle_t *handle, int16_t *adc_raw,
         return ADS1115_ERROR_NULL_POINTER;
 
     uint16_t config_reg;
+    bus_acquire(handle);
     ads1115_error_t err = read_register(handle, ADS1115_REG_CONFIG, &config_reg);
+    if (err == ADS1115_OK)
+        err = write_register(handle, ADS1115_REG_CONFIG, config_reg | ADS1115_OS_START_SINGLE);
+    bus_release(handle);
     if (err != ADS1115_OK)
         return err;
 
-    config_reg |= ADS1115_OS_START_SINGLE;
-    if ((err = write_register(handle, ADS1115_REG_CONFIG, config_reg)) != ADS1115_OK)
-        return err;
-
-    /* Timing Calculation */
+    /* Timing Calculation (the bus is free for other handles meanwhile) */
     uint32_t wait_us = ADS1115_CONV_TIME_US[handle->config.data_rate];
     handle->delay_ms((wait_us / 1000) + 1);
 
     uint16_t raw;
-    if ((err = read_register(handle, ADS1115_REG_CONVERSION, &raw)) == ADS1115_OK)
+    if ((err = read_register_locked(handle, ADS1115_REG_CONVERSION, &raw)) == ADS1115_OK)
+    {
+        *adc_raw = (int16_t)raw;
+        *voltage = raw_to_voltage(handle->config.range, *adc_raw);
+    }
+    return err;
+}
+
+ads1115_error_t ads1115_single_start(ads1115_handle_t *handle)
+{
+    if (!handle->is_initialized)
+        return ADS1115_ERROR_NOT_INITIALIZED;
+    if (handle->config.mode != ADS1115_MODE_SINGLE_SHOT)
+        return ADS1115_ERROR_INVALID_PARAM;
+    return write_register_locked(handle, ADS1115_REG_CONFIG, build_config_register(&handle->config) | ADS1115_OS_START_SINGLE);
+}
+
+ads1115_error_t ads1115_single_collect(ads1115_handle_t *handle, int16_t *adc_raw, float *voltage)
+{
+    if (!handle->is_initialized)
+        return ADS1115_ERROR_NOT_INITIALIZED;
+    if (!adc_raw || !voltage)
+        return ADS1115_ERROR_NULL_POINTER;
+    uint16_t raw;
+    ads1115_error_t err = read_register_locked(handle, ADS1115_REG_CONVERSION, &raw);
+    if (err == ADS1115_OK)
     {
         *adc_raw = (int16_t)raw;
         *voltage = raw_to_voltage(handle->config.range, *adc_raw);
@@ -288,15 +373,38 @@ ads1115_error_t ads1115_single_read(ads1115_handle_t *handle, int16_t *adc_raw,
     return err;
 }
 
+ads1115_error_t ads1115_single_start_collect(ads1115_handle_t *handle, int16_t *adc_raw)
+{
+    if (!handle->is_initialized)
+        return ADS1115_ERROR_NOT_INITIALIZED;
+    if (!adc_raw)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (handle->config.mode != ADS1115_MODE_SINGLE_SHOT)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    /* One bus claim: no other handle can delay the read past the new conversion */
+    uint16_t raw;
+    bus_acquire(handle);
+    ads1115_error_t err = write_register(handle, ADS1115_REG_CONFIG, build_config_register(&handle->config) | ADS1115_OS_START_SINGLE);
+    if (err == ADS1115_OK)
+        err = read_register(handle, ADS1115_REG_CONVERSION, &raw);
+    bus_release(handle);
+    if (err == ADS1115_OK)
+        *adc_raw = (int16_t)raw;
+    return err;
+}
+
 /* Threshold & Ready Control */
 ads1115_error_t ads1115_set_compare_threshold(ads1115_handle_t *handle, int16_t low, int16_t high)
 {
     if (!handle->is_initialized)
         return ADS1115_ERROR_NOT_INITIALIZED;
-    ads1115_error_t err;
-    if ((err = write_register(handle, ADS1115_REG_LO_THRESH, (uint16_t)low)) != ADS1115_OK)
-        return err;
-    if ((err = write_register(handle, ADS1115_REG_HI_THRESH, (uint16_t)high)) != ADS1115_OK)
+    bus_acquire(handle);
+    ads1115_error_t err = write_register(handle, ADS1115_REG_LO_THRESH, (uint16_t)low);
+    if (err == ADS1115_OK)
+        err = write_register(handle, ADS1115_REG_HI_THRESH, (uint16_t)high);
+    bus_release(handle);
+    if (err != ADS1115_OK)
         return err;
     handle->config.low_threshold = low;
     handle->config.high_threshold = high;
@@ -310,11 +418,61 @@ ads1115_error_t ads1115_is_ready(ads1115_handle_t *handle, bool *flag)
     if (!flag)
         return ADS1115_ERROR_NULL_POINTER;
     uint16_t reg;
-    ads1115_error_t err = read_register(handle, ADS1115_REG_CONFIG, &reg);
+    ads1115_error_t err = read_register_locked(handle, ADS1115_REG_CONFIG, &reg);
     if (err == ADS1115_OK)
         *flag = (reg & ADS1115_OS_MASK) != 0;
     return err;
 }
 
+/* Timing & Noise Model */
+ads1115_error_t ads1115_get_conversion_time_us(ads1115_data_rate_t data_rate, uint32_t *time_us)
+{
+    if (!time_us)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (data_rate > ADS1115_DR_860_SPS)
+        return ADS1115_ERROR_INVALID_PARAM;
+    *time_us = ADS1115_CONV_TIME_US[data_rate];
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_get_conversion_time_max_us(ads1115_data_rate_t data_rate, uint32_t *time_us)
+{
+    if (!time_us)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (data_rate > ADS1115_DR_860_SPS)
+        return ADS1115_ERROR_INVALID_PARAM;
+    uint32_t nominal = ADS1115_CONV_TIME_US[data_rate];
+    /* A data rate 10% slow stretches the conversion to nominal / 0.9, not nominal * 1.1 */
+    uint32_t divisor = 100U - ADS1115_OSC_TOLERANCE_PCT;
+    *time_us = (nominal * 100U + divisor - 1U) / divisor;
+    return ADS1115_OK;
+}
+
+bool ads1115_time_reached(uint32_t now_us, uint32_t t_us)
+{
+    return (int32_t)(now_us - t_us) >= 0;
+}
+
+ads1115_error_t ads1115_get_noise_uv(ads1115_range_t range, ads1115_data_rate_t data_rate, float *rms_uv, float *pp_uv)
+{
+    if (range > ADS1115_RANGE_0V256 || data_rate > ADS1115_DR_860_SPS)
+        return ADS1115_ERROR_INVALID_PARAM;
+    if (rms_uv)
+        *rms_uv = ADS1115_NOISE_RMS_UV[range];
+    if (pp_uv)
+        *pp_uv = ADS1115_NOISE_PP_UV[data_rate][range];
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_raw_to_voltage(ads1115_range_t range, int16_t adc_raw, float *voltage)
+{
+    if (!voltage)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (range > ADS1115_RANGE_0V256)
+        return ADS1115_ERROR_INVALID_PARAM;
+    *voltage = raw_to_voltage(range, adc_raw);
+    return ADS1115_OK;
+}
+
 /** @} */ // End of ADS1115_Functions
 /** @} */ // End of ADS1115_Driver
\ No newline at end of file
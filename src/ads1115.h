@@ -198,6 +198,11 @@ typedef struct
     int16_t high_threshold;           /**< High threshold register value */
 } ads1115_config_t;
 
+/**
+ * @brief Shared-bus arbitration object, defined in ads1115_bus.h
+ */
+typedef struct ads1115_bus ads1115_bus_t;
+
 /**
  * @brief ADS1115 device handle
  */
@@ -209,6 +214,8 @@ typedef struct
     ads1115_i2c_read_t i2c_read;   /**< Hardware read function */
     ads1115_delay_ms_t delay_ms;   /**< Hardware delay function */
     bool is_initialized;           /**< Internal state flag */
+    ads1115_bus_t *bus;            /**< Shared bus to arbitrate on, NULL if the handle owns the bus */
+    uint8_t bus_priority;          /**< @ref ads1115_bus_priority_t used on @ref bus */
 } ads1115_handle_t;
 
 /** @} */
@@ -322,6 +329,42 @@ ads1115_error_t ads1115_continuous_conversion_read(ads1115_handle_t *handle, int
  */
 ads1115_error_t ads1115_single_read(ads1115_handle_t *handle, int16_t *adc_raw, float *voltage);
 
+/**
+ * @brief Starts a single-shot conversion without waiting for the result.
+ * @details Writes the complete configuration held in the handle together with the
+ * OS bit in one I2C transaction, so a new MUX/range/data rate takes effect for the
+ * conversion being started. The handle must be in single-shot mode.
+ * @param handle Pointer to the device handle structure.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_single_start(ads1115_handle_t *handle);
+
+/**
+ * @brief Collects the result of a conversion started with @ref ads1115_single_start.
+ * @details Reads the Conversion register only; the caller is responsible for having
+ * waited the conversion time (see @ref ads1115_get_conversion_time_us) or for having
+ * checked @ref ads1115_is_ready.
+ * @param handle Pointer to the device handle structure.
+ * @param[out] adc_raw Raw 16-bit signed integer output.
+ * @param[out] voltage Calculated voltage, scaled like @ref ads1115_single_read.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_single_collect(ads1115_handle_t *handle, int16_t *adc_raw, float *voltage);
+
+/**
+ * @brief Starts the next single-shot conversion and reads the previous result.
+ * @details Performs @ref ads1115_single_start followed by a Conversion register read
+ * under one bus claim. The register keeps the previous result until the new
+ * conversion completes, and holding the bus keeps other handles from pushing the
+ * read past that point. The handle must be in single-shot mode and the previous
+ * conversion must be complete.
+ * @param handle Pointer to the device handle structure.
+ * @param[out] adc_raw Raw result of the previous conversion; convert it with
+ * @ref ads1115_raw_to_voltage and the range that conversion used.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_single_start_collect(ads1115_handle_t *handle, int16_t *adc_raw);
+
 /**
  * @brief Selects the input channel(s) via the multiplexer.
  * @param handle Pointer to the device handle structure.
@@ -428,6 +471,60 @@ ads1115_error_t ads1115_get_compare_latch(ads1115_handle_t *handle, ads1115_comp
  */
 ads1115_error_t ads1115_is_ready(ads1115_handle_t *handle, bool *flag);
 
+/**
+ * @brief Returns the nominal conversion time for a data rate.
+ * @details The data rate is specified to @f$\pm 10\%@f$, so the actual conversion
+ * time may be up to 1/0.9 of the value returned here (see
+ * @ref ads1115_get_conversion_time_max_us).
+ * @param data_rate Samples per second selection.
+ * @param[out] time_us Pointer to store the conversion time in microseconds.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_get_conversion_time_us(ads1115_data_rate_t data_rate, uint32_t *time_us);
+
+/**
+ * @brief Returns the worst-case conversion time for a data rate.
+ * @details Nominal time divided by 0.9 (data rate 10% below nominal), rounded up;
+ * 1293 us at 860 SPS. Waiting this long after the start write has completed
+ * guarantees the result is in the Conversion register.
+ * @param data_rate Samples per second selection.
+ * @param[out] time_us Pointer to store the conversion time in microseconds.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_get_conversion_time_max_us(ads1115_data_rate_t data_rate, uint32_t *time_us);
+
+/**
+ * @brief Wrap-around safe check that a microsecond timestamp has been reached.
+ * @details Valid while @p now_us and @p t_us are less than 2^31 us (about 35 minutes) apart.
+ * @param now_us Current time in microseconds.
+ * @param t_us Time to compare against.
+ * @return true if @p now_us is at or after @p t_us.
+ */
+bool ads1115_time_reached(uint32_t now_us, uint32_t t_us);
+
+/**
+ * @brief Returns the datasheet input-referred noise for a range/data rate pair.
+ * @details Values are taken from the datasheet noise table at VDD = 3.3V. The
+ * RMS figure never drops below one LSB since the table is quantization limited.
+ * @param range Full-scale range selection.
+ * @param data_rate Samples per second selection.
+ * @param[out] rms_uv Pointer to store the RMS noise in microvolts (may be NULL).
+ * @param[out] pp_uv Pointer to store the peak-to-peak noise in microvolts (may be NULL).
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_get_noise_uv(ads1115_range_t range, ads1115_data_rate_t data_rate, float *rms_uv, float *pp_uv);
+
+/**
+ * @brief Converts a raw conversion result with the driver transfer function.
+ * @details Uses the same scaling as @ref ads1115_single_read, for code that obtains
+ * raw codes without going through a handle read.
+ * @param range Full-scale range the code was converted with.
+ * @param adc_raw Raw 16-bit signed conversion result.
+ * @param[out] voltage Calculated voltage.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_raw_to_voltage(ads1115_range_t range, int16_t adc_raw, float *voltage);
+
 /** @} */ // End of ADS1115_Functions
 /** @} */ // End of ADS1115_Driver
 
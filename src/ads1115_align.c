@@ -0,0 +1,255 @@
+/**
+ * @file ads1115_align.c
+ * @brief ADS1115 Multi-Device Timestamp Alignment and Resampling - Implementation File
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ */
+
+#include "ads1115_align.h"
+#include <stddef.h>
+
+/**
+ * @addtogroup ADS1115_Align
+ * @{
+ */
+
+/*===========================================================================*/
+/* PRIVATE CONSTANTS                                                         */
+/*===========================================================================*/
+
+/** @brief Phase correction gain of the tracker, 1/2^n */
+#define ALIGN_ALPHA_SHIFT 4
+
+/** @brief Period correction gain of the tracker, 1/2^n (close to critical damping) */
+#define ALIGN_BETA_SHIFT 9
+
+/** @brief Period estimate is clamped to nominal +/- this percentage */
+#define ALIGN_PERIOD_LIMIT_PCT 15U
+
+/** @brief Intervals averaged into the initial period estimate after a (re)start */
+#define ALIGN_SEED_INTERVALS 16U
+
+/** @brief Longest gap (in periods) bridged before the tracker restarts */
+#define ALIGN_MAX_GAP 16U
+
+#define ALIGN_HISTORY_MASK (ADS1115_ALIGN_HISTORY - 1U)
+
+#if (ADS1115_ALIGN_HISTORY & (ADS1115_ALIGN_HISTORY - 1)) != 0 || ADS1115_ALIGN_HISTORY < 2
+#error "ADS1115_ALIGN_HISTORY must be a power of two and at least 2"
+#endif
+
+/*===========================================================================*/
+/* PRIVATE FUNCTIONS                                                         */
+/*===========================================================================*/
+
+/**
+ * @brief Extends a wrapping microsecond timestamp to Q8 on the aligner epoch.
+ */
+static int64_t extend_time(ads1115_align_t *align, uint32_t timestamp_us)
+{
+    if (!align->has_time)
+    {
+        align->has_time = true;
+        align->last_timestamp_us = timestamp_us;
+        align->last_time_q8 = 0;
+        return 0;
+    }
+    int64_t t = align->last_time_q8 + (int64_t)(int32_t)(timestamp_us - align->last_timestamp_us) * 256;
+    if (t > align->last_time_q8)
+    {
+        align->last_time_q8 = t;
+        align->last_timestamp_us = timestamp_us;
+    }
+    return t;
+}
+
+static int64_t newest_time(const ads1115_align_stream_t *s)
+{
+    return s->time_q8[(s->count - 1U) & ALIGN_HISTORY_MASK];
+}
+
+static int64_t oldest_time(const ads1115_align_stream_t *s)
+{
+    uint32_t kept = s->count < ADS1115_ALIGN_HISTORY ? s->count : ADS1115_ALIGN_HISTORY;
+    return s->time_q8[(s->count - kept) & ALIGN_HISTORY_MASK];
+}
+
+/**
+ * @brief Linear interpolation of a stream at time @p t (Q16 fraction, 64-bit products).
+ */
+static int16_t interpolate(ads1115_align_stream_t *s, int64_t t)
+{
+    uint32_t kept = s->count < ADS1115_ALIGN_HISTORY ? s->count : ADS1115_ALIGN_HISTORY;
+    uint32_t first = s->count - kept;
+
+    for (uint32_t n = s->count - 1U; n > first; n--)
+    {
+        int64_t t0 = s->time_q8[(n - 1U) & ALIGN_HISTORY_MASK];
+        int64_t t1 = s->time_q8[n & ALIGN_HISTORY_MASK];
+        if (t0 > t)
+            continue;
+        int32_t v0 = s->value[(n - 1U) & ALIGN_HISTORY_MASK];
+        int32_t v1 = s->value[n & ALIGN_HISTORY_MASK];
+        if (t1 <= t0)
+            return (int16_t)v1;
+        int64_t frac = ((t - t0) << 16) / (t1 - t0);
+        return (int16_t)(v0 + (((int64_t)(v1 - v0) * frac) >> 16));
+    }
+
+    /* The bracketing pair has already left the history */
+    s->overruns++;
+    return s->value[first & ALIGN_HISTORY_MASK];
+}
+
+/*===========================================================================*/
+/* PUBLIC API IMPLEMENTATIONS                                                */
+/*===========================================================================*/
+
+ads1115_error_t ads1115_align_init(ads1115_align_t *align, ads1115_align_stream_t *streams, uint8_t stream_count,
+                                   uint32_t output_period_us)
+{
+    if (align == NULL || streams == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (stream_count == 0 || stream_count > ADS1115_ALIGN_MAX_STREAMS || output_period_us == 0 || output_period_us > 0xFFFFFFU)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    for (uint8_t i = 0; i < stream_count; i++)
+    {
+        ads1115_align_stream_t *s = &streams[i];
+        uint32_t nominal_us;
+        if (ads1115_get_conversion_time_us(s->data_rate, &nominal_us) != ADS1115_OK)
+            return ADS1115_ERROR_INVALID_PARAM;
+        s->nominal_period_q8 = nominal_us * 256U;
+        s->period_q8 = s->nominal_period_q8;
+        s->count = 0;
+        s->gaps = 0;
+        s->overruns = 0;
+    }
+
+    align->streams = streams;
+    align->stream_count = stream_count;
+    align->output_period_q8 = output_period_us * 256U;
+    align->next_output_q8 = 0;
+    align->last_timestamp_us = 0;
+    align->last_time_q8 = 0;
+    align->has_time = false;
+    align->started = false;
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_align_push(ads1115_align_t *align, uint8_t stream_index, uint32_t timestamp_us, int16_t adc_raw)
+{
+    if (align == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (stream_index >= align->stream_count)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    ads1115_align_stream_t *s = &align->streams[stream_index];
+    int64_t measured = extend_time(align, timestamp_us);
+    int64_t smoothed = measured;
+
+    if (s->count > 0)
+    {
+        /* Steps come from the raw inter-arrival time, not the tracker prediction, which
+         * lags by up to the oscillator tolerance while the period estimate converges */
+        int64_t limit = (int64_t)s->nominal_period_q8 * ALIGN_PERIOD_LIMIT_PCT / 100;
+        int64_t interval = measured - s->last_measured_q8;
+        int64_t period = s->period_q8;
+        int64_t steps = (interval + period / 2) / period;
+        if (steps < 1)
+            steps = 1;
+
+        if (steps >= (int64_t)ALIGN_MAX_GAP)
+        {
+            /* Gap too long to bridge: count what was missed over the elapsed time, then
+             * restart the stream from this sample and re-anchor the output timebase */
+            s->gaps += steps - 1 > (int64_t)UINT32_MAX ? UINT32_MAX : (uint32_t)(steps - 1);
+            s->count = 0;
+            s->period_q8 = s->nominal_period_q8;
+            align->started = false;
+        }
+        else
+        {
+            int64_t predicted = newest_time(s) + steps * period;
+            int64_t err = measured - predicted;
+            s->gaps += (uint32_t)(steps - 1);
+            smoothed = predicted + err / (1 << ALIGN_ALPHA_SHIFT);
+            if (s->count <= ALIGN_SEED_INTERVALS)
+            {
+                /* Warm-up: running mean of the measured intervals, so a device anywhere
+                 * inside its tolerance is tracked from the start */
+                period += (interval / steps - period) / (int64_t)s->count;
+            }
+            else if (steps == 1)
+            {
+                period += err / (1 << ALIGN_BETA_SHIFT);
+            }
+            if (period > (int64_t)s->nominal_period_q8 + limit)
+                period = (int64_t)s->nominal_period_q8 + limit;
+            if (period < (int64_t)s->nominal_period_q8 - limit)
+                period = (int64_t)s->nominal_period_q8 - limit;
+            s->period_q8 = (uint32_t)period;
+        }
+    }
+
+    s->last_measured_q8 = measured;
+    s->time_q8[s->count & ALIGN_HISTORY_MASK] = smoothed;
+    s->value[s->count & ALIGN_HISTORY_MASK] = adc_raw;
+    s->count++;
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_align_pop(ads1115_align_t *align, ads1115_align_frame_t *frame, bool *ready)
+{
+    if (align == NULL || frame == NULL || ready == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+
+    *ready = false;
+    int64_t covered = INT64_MAX;
+    int64_t start = INT64_MIN;
+    for (uint8_t i = 0; i < align->stream_count; i++)
+    {
+        const ads1115_align_stream_t *s = &align->streams[i];
+        if (s->count < 2U)
+            return ADS1115_OK;
+        if (newest_time(s) < covered)
+            covered = newest_time(s);
+        if (oldest_time(s) > start)
+            start = oldest_time(s);
+    }
+
+    if (!align->started)
+    {
+        align->next_output_q8 = start;
+        align->started = true;
+    }
+    if (align->next_output_q8 > covered)
+        return ADS1115_OK;
+
+    int64_t t = align->next_output_q8;
+    frame->timestamp_us = align->last_timestamp_us + (uint32_t)((t - align->last_time_q8) / 256);
+    for (uint8_t i = 0; i < align->stream_count; i++)
+        frame->adc_raw[i] = interpolate(&align->streams[i], t);
+
+    align->next_output_q8 += align->output_period_q8;
+    *ready = true;
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_align_get_rate(const ads1115_align_t *align, uint8_t stream_index, uint32_t *period_ns, int32_t *error_ppm)
+{
+    if (align == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (stream_index >= align->stream_count)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    const ads1115_align_stream_t *s = &align->streams[stream_index];
+    if (period_ns)
+        *period_ns = (uint32_t)(((uint64_t)s->period_q8 * 1000U) / 256U);
+    if (error_ppm)
+        *error_ppm = (int32_t)(((int64_t)s->nominal_period_q8 - (int64_t)s->period_q8) * 1000000 / (int64_t)s->period_q8);
+    return ADS1115_OK;
+}
+
+/** @} */ // End of ADS1115_Align
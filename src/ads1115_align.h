@@ -0,0 +1,140 @@
+/**
+ * @file ads1115_align.h
+ * @brief ADS1115 Multi-Device Timestamp Alignment and Resampling - Header File
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ *
+ * @details Devices running continuous conversion on their own internal oscillators
+ * (@f$\pm 10\%@f$) drift apart. This stage tracks every stream's true sample period
+ * from its data-ready timestamps with a fixed-point alpha-beta filter, compares it
+ * with the nominal conversion time, and resamples all streams onto one common
+ * output timebase by linear interpolation. It is incremental and allocation-free:
+ * push samples as they arrive and pop aligned frames as they become complete.
+ */
+
+#ifndef ADS1115_ALIGN_H
+#define ADS1115_ALIGN_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include "ads1115.h"
+
+/**
+ * @defgroup ADS1115_Align Stream Alignment
+ * @ingroup ADS1115_Driver
+ * @brief Rate estimation and resampling of several device streams onto one timebase.
+ * @{
+ */
+
+/** @brief Maximum number of streams in one aligner. */
+#ifndef ADS1115_ALIGN_MAX_STREAMS
+#define ADS1115_ALIGN_MAX_STREAMS 8
+#endif
+
+/**
+ * @brief Samples kept per stream (power of two).
+ * @details Must exceed the number of samples the fastest stream can run ahead of
+ * the slowest one between two output frames.
+ */
+#ifndef ADS1115_ALIGN_HISTORY
+#define ADS1115_ALIGN_HISTORY 8
+#endif
+
+/**
+ * @brief Per-stream tracking state (one device in continuous mode).
+ */
+typedef struct
+{
+    ads1115_data_rate_t data_rate;              /**< Nominal data rate of the device */
+    uint32_t nominal_period_q8;                 /**< Nominal period, microseconds in Q24.8 */
+    uint32_t period_q8;                         /**< Estimated period, microseconds in Q24.8 */
+    int64_t time_q8[ADS1115_ALIGN_HISTORY];     /**< Smoothed sample times, Q8 microseconds */
+    int16_t value[ADS1115_ALIGN_HISTORY];       /**< Raw codes matching @ref time_q8 */
+    int64_t last_measured_q8;                   /**< Unsmoothed time of the newest sample, Q8 microseconds */
+    uint32_t count;                             /**< Samples received since the tracker (re)started */
+    uint32_t gaps;                              /**< Missing samples detected from timestamps */
+    uint32_t overruns;                          /**< Frames interpolated without a bracketing pair */
+} ads1115_align_stream_t;
+
+/**
+ * @brief One aligned output frame.
+ */
+typedef struct
+{
+    uint32_t timestamp_us;                      /**< Common-timebase time of the frame */
+    int16_t adc_raw[ADS1115_ALIGN_MAX_STREAMS]; /**< Resampled raw code per stream */
+} ads1115_align_frame_t;
+
+/**
+ * @brief Aligner instance.
+ */
+typedef struct
+{
+    ads1115_align_stream_t *streams; /**< Application-owned stream table */
+    uint8_t stream_count;            /**< Number of streams */
+    uint32_t output_period_q8;       /**< Output frame period, Q24.8 microseconds */
+    int64_t next_output_q8;          /**< Time of the next frame, valid once @ref started */
+    uint32_t last_timestamp_us;      /**< Last raw timestamp seen, for wrap extension */
+    int64_t last_time_q8;            /**< Extended time of @ref last_timestamp_us */
+    bool has_time;                   /**< A timestamp has been seen */
+    bool started;                    /**< Output timebase established */
+} ads1115_align_t;
+
+/**
+ * @brief Initializes the aligner.
+ * @details Each stream's @ref ads1115_align_stream_t::data_rate must be set before the call.
+ * @param align Pointer to the aligner.
+ * @param streams Stream table (kept by reference).
+ * @param stream_count Number of streams, at most @ref ADS1115_ALIGN_MAX_STREAMS.
+ * @param output_period_us Period of the common output timebase.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_align_init(ads1115_align_t *align, ads1115_align_stream_t *streams, uint8_t stream_count,
+                                   uint32_t output_period_us);
+
+/**
+ * @brief Feeds one sample of a stream.
+ * @details Missing samples are detected from the raw interval to the previous
+ * sample, and the period estimate starts as the mean of the first measured
+ * intervals, so a device anywhere inside its oscillator tolerance is tracked
+ * without false gaps. A gap of 16 periods or more restarts the stream: its
+ * history and period estimate are dropped, the missed samples are added to
+ * @ref ads1115_align_stream_t::gaps and output frames resume once every stream
+ * again covers a common interval.
+ * @param align Pointer to the aligner.
+ * @param stream_index Stream the sample belongs to.
+ * @param timestamp_us Data-ready time of the sample (wrap-around safe).
+ * @param adc_raw Raw conversion result.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_align_push(ads1115_align_t *align, uint8_t stream_index, uint32_t timestamp_us, int16_t adc_raw);
+
+/**
+ * @brief Retrieves the next aligned frame if every stream has covered it.
+ * @param align Pointer to the aligner.
+ * @param[out] frame Pointer to store the frame.
+ * @param[out] ready Set to true if @p frame was filled.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_align_pop(ads1115_align_t *align, ads1115_align_frame_t *frame, bool *ready);
+
+/**
+ * @brief Reports the estimated sample period of a stream and its deviation from nominal.
+ * @param align Pointer to the aligner.
+ * @param stream_index Stream to query.
+ * @param[out] period_ns Estimated period in nanoseconds (may be NULL).
+ * @param[out] error_ppm Oscillator deviation in ppm, positive when the device runs fast (may be NULL).
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_align_get_rate(const ads1115_align_t *align, uint8_t stream_index, uint32_t *period_ns, int32_t *error_ppm);
+
+/** @} */ // End of ADS1115_Align
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADS1115_ALIGN_H */
@@ -0,0 +1,96 @@
+/**
+ * @file ads1115_bus.c
+ * @brief ADS1115 Shared-Bus Arbitration - Implementation File
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ */
+
+#include "ads1115_bus.h"
+#include <stddef.h>
+
+/**
+ * @addtogroup ADS1115_Bus
+ * @{
+ */
+
+/*===========================================================================*/
+/* PRIVATE FUNCTIONS                                                         */
+/*===========================================================================*/
+
+/**
+ * @brief True if a caller of @p priority must not take the bus yet.
+ */
+static bool must_wait(const ads1115_bus_t *bus, uint8_t priority)
+{
+    if (bus->busy)
+        return true;
+    for (uint8_t p = (uint8_t)(priority + 1U); p < ADS1115_BUS_PRIORITIES; p++)
+    {
+        if (bus->waiting[p] > 0)
+            return true;
+    }
+    return false;
+}
+
+/*===========================================================================*/
+/* PUBLIC API IMPLEMENTATIONS                                                */
+/*===========================================================================*/
+
+ads1115_error_t ads1115_bus_init(ads1115_bus_t *bus, ads1115_bus_lock_t lock, ads1115_bus_unlock_t unlock, ads1115_bus_wait_t wait,
+                                 ads1115_bus_broadcast_t broadcast, void *os_ctx)
+{
+    if (bus == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (!lock || !unlock || !wait || !broadcast)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    bus->lock = lock;
+    bus->unlock = unlock;
+    bus->wait = wait;
+    bus->broadcast = broadcast;
+    bus->os_ctx = os_ctx;
+    bus->acquire = ads1115_bus_acquire;
+    bus->release = ads1115_bus_release;
+    bus->busy = false;
+    for (uint8_t p = 0; p < ADS1115_BUS_PRIORITIES; p++)
+        bus->waiting[p] = 0;
+    bus->acquisitions = 0;
+    bus->contended = 0;
+    return ADS1115_OK;
+}
+
+void ads1115_bus_acquire(ads1115_bus_t *bus, uint8_t priority)
+{
+    if (priority >= ADS1115_BUS_PRIORITIES)
+        priority = ADS1115_BUS_PRIORITIES - 1U;
+
+    bus->lock(bus->os_ctx);
+    if (must_wait(bus, priority))
+    {
+        bus->contended++;
+        bus->waiting[priority]++;
+        do
+        {
+            bus->wait(bus->os_ctx);
+        } while (must_wait(bus, priority));
+        bus->waiting[priority]--;
+    }
+    bus->busy = true;
+    bus->acquisitions++;
+    bus->unlock(bus->os_ctx);
+}
+
+void ads1115_bus_release(ads1115_bus_t *bus)
+{
+    bus->lock(bus->os_ctx);
+    bus->busy = false;
+    bool wake = false;
+    for (uint8_t p = 0; p < ADS1115_BUS_PRIORITIES; p++)
+        wake = wake || bus->waiting[p] > 0;
+    if (wake)
+        bus->broadcast(bus->os_ctx);
+    bus->unlock(bus->os_ctx);
+}
+
+/** @} */ // End of ADS1115_Bus
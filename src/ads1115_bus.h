@@ -0,0 +1,112 @@
+/**
+ * @file ads1115_bus.h
+ * @brief ADS1115 Shared-Bus Arbitration - Header File
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ *
+ * @details A bus object shared by every handle on one I2C bus. When
+ * @ref ads1115_handle_t::bus is set, each driver operation claims the bus for
+ * its register transactions only, so operations from different threads never
+ * interleave mid-sequence. The conversion wait of @ref ads1115_single_read runs
+ * with the bus released. Between operations the bus goes to the waiter with the
+ * highest @ref ads1115_handle_t::bus_priority.
+ *
+ * The bus is platform independent: it only needs a mutex and a condition
+ * variable, supplied as callbacks (see interface/ads1115_bus_posix.h for
+ * pthreads). The mutex is held only while the bus state is updated, never
+ * across an I2C transaction.
+ */
+
+#ifndef ADS1115_BUS_H
+#define ADS1115_BUS_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include "ads1115.h"
+
+/**
+ * @defgroup ADS1115_Bus Shared-Bus Arbitration
+ * @ingroup ADS1115_Driver
+ * @brief Serialises driver operations of several handles on one bus.
+ * @{
+ */
+
+/**
+ * @brief Bus priority of a handle; higher values are served first.
+ */
+typedef enum
+{
+    ADS1115_BUS_PRIO_LOW = 0,    /**< Logging, diagnostics - Default */
+    ADS1115_BUS_PRIO_NORMAL = 1, /**< Regular acquisition */
+    ADS1115_BUS_PRIO_HIGH = 2,   /**< Control loops */
+} ads1115_bus_priority_t;
+
+/** @brief Number of priority levels. */
+#define ADS1115_BUS_PRIORITIES 3
+
+typedef void (*ads1115_bus_lock_t)(void *os_ctx);      /**< Lock the mutex */
+typedef void (*ads1115_bus_unlock_t)(void *os_ctx);    /**< Unlock the mutex */
+typedef void (*ads1115_bus_wait_t)(void *os_ctx);      /**< Atomically unlock, wait for a broadcast, relock */
+typedef void (*ads1115_bus_broadcast_t)(void *os_ctx); /**< Wake all waiters */
+
+/**
+ * @brief Shared bus state (declared as @ref ads1115_bus_t in ads1115.h).
+ * @details The driver claims the bus through the @c acquire and @c release members, so
+ * ads1115.c does not link against this module; only applications that set
+ * @ref ads1115_handle_t::bus need to compile ads1115_bus.c.
+ */
+struct ads1115_bus
+{
+    ads1115_bus_lock_t lock;                                /**< Mutex lock */
+    ads1115_bus_unlock_t unlock;                            /**< Mutex unlock */
+    ads1115_bus_wait_t wait;                                /**< Condition wait */
+    ads1115_bus_broadcast_t broadcast;                      /**< Condition broadcast */
+    void *os_ctx;                                           /**< Passed to the callbacks */
+    void (*acquire)(ads1115_bus_t *bus, uint8_t priority);  /**< Set to @ref ads1115_bus_acquire by init */
+    void (*release)(ads1115_bus_t *bus);                    /**< Set to @ref ads1115_bus_release by init */
+    bool busy;                                              /**< An operation owns the bus */
+    uint16_t waiting[ADS1115_BUS_PRIORITIES];               /**< Waiters per priority */
+    uint32_t acquisitions;                                  /**< Operations served */
+    uint32_t contended;                                     /**< Operations that had to wait */
+};
+
+/**
+ * @brief Initializes a bus object.
+ * @param bus Pointer to the bus.
+ * @param lock Mutex lock callback.
+ * @param unlock Mutex unlock callback.
+ * @param wait Condition wait callback (must be used with the same mutex).
+ * @param broadcast Condition broadcast callback.
+ * @param os_ctx Opaque pointer handed to the callbacks.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_bus_init(ads1115_bus_t *bus, ads1115_bus_lock_t lock, ads1115_bus_unlock_t unlock, ads1115_bus_wait_t wait,
+                                 ads1115_bus_broadcast_t broadcast, void *os_ctx);
+
+/**
+ * @brief Claims the bus, waiting behind busy owners and higher-priority waiters.
+ * @details Called by the driver around the register transactions of every
+ * operation. Not reentrant: while a thread holds the bus, driver functions on
+ * handles attached to it block forever, so operations cannot be grouped under
+ * one claim.
+ * @param bus Pointer to the bus.
+ * @param priority @ref ads1115_bus_priority_t of the caller.
+ */
+void ads1115_bus_acquire(ads1115_bus_t *bus, uint8_t priority);
+
+/**
+ * @brief Releases the bus and wakes waiters.
+ * @param bus Pointer to the bus.
+ */
+void ads1115_bus_release(ads1115_bus_t *bus);
+
+/** @} */ // End of ADS1115_Bus
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADS1115_BUS_H */
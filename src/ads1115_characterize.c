@@ -0,0 +1,233 @@
+/**
+ * @file ads1115_characterize.c
+ * @brief ADS1115 Noise/Rate Characterisation - Implementation File
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ */
+
+#include "ads1115_characterize.h"
+#include "ads1115_stats.h"
+#include <math.h>
+#include <stddef.h>
+
+/**
+ * @addtogroup ADS1115_Characterize
+ * @{
+ */
+
+/*===========================================================================*/
+/* PRIVATE CONSTANTS                                                         */
+/*===========================================================================*/
+
+/** @brief Peak-to-peak to RMS ratio of Gaussian noise (99.9% of samples) */
+#define CHAR_CREST_FACTOR 6.6f
+
+/** @brief Conversions buffered before they are folded into the statistics */
+#define CHAR_BLOCK 32U
+
+/*===========================================================================*/
+/* PRIVATE FUNCTIONS                                                         */
+/*===========================================================================*/
+
+/**
+ * @brief LSB size of a range in microvolts, from the driver transfer function (mV).
+ */
+static float lsb_uv(ads1115_range_t range)
+{
+    float lsb_mv = 0.0f;
+    ads1115_raw_to_voltage(range, 1, &lsb_mv);
+    return lsb_mv * 1000.0f;
+}
+
+/**
+ * @brief Fills the resolution figures of a point from its noise in LSB.
+ * @details Noise below the quantization floor (LSB / sqrt(12) RMS, 1 LSB
+ * peak-to-peak) is clamped to it.
+ */
+static void set_noise(ads1115_char_point_t *point, ads1115_range_t range, float rms_lsb, float pp_lsb)
+{
+    float floor_lsb = 1.0f / sqrtf(12.0f);
+    if (rms_lsb < floor_lsb)
+        rms_lsb = floor_lsb;
+    if (pp_lsb < 1.0f)
+        pp_lsb = 1.0f;
+    float lsb = lsb_uv(range);
+    point->noise_rms_uv = rms_lsb * lsb;
+    point->noise_pp_uv = pp_lsb * lsb;
+    point->effective_bits = 16.0f - log2f(rms_lsb);
+    point->noise_free_bits = 16.0f - log2f(pp_lsb);
+}
+
+/**
+ * @brief Takes @p samples conversions with the current handle configuration.
+ */
+static ads1115_error_t measure_point(ads1115_handle_t *handle, uint16_t samples, ads1115_char_point_t *point)
+{
+    ads1115_stats_t stats;
+    ads1115_stats_result_t result;
+    int16_t block[CHAR_BLOCK];
+    uint32_t fill = 0;
+    uint32_t wait_us = 0;
+    ads1115_error_t err;
+
+    ads1115_get_conversion_time_us(handle->config.data_rate, &wait_us);
+    ads1115_stats_init(&stats, INT16_MIN, 12U); /* Histogram not used */
+    for (uint16_t n = 0; n < samples; n++)
+    {
+        float voltage;
+        if ((err = ads1115_single_start(handle)) != ADS1115_OK)
+            return err;
+        handle->delay_ms(wait_us / 1000U + 1U);
+        if ((err = ads1115_single_collect(handle, &block[fill], &voltage)) != ADS1115_OK)
+            return err;
+        if (++fill == CHAR_BLOCK)
+        {
+            ads1115_stats_update(&stats, block, fill);
+            fill = 0;
+        }
+    }
+    ads1115_stats_update(&stats, block, fill);
+    if ((err = ads1115_stats_finalize(&stats, &handle->config, &result)) != ADS1115_OK)
+        return err;
+
+    float lsb;
+    ads1115_raw_to_voltage(handle->config.range, 1, &lsb);
+    point->usable = result.min_raw > INT16_MIN && result.max_raw < INT16_MAX;
+    point->mean = result.mean;
+    point->time_us = wait_us;
+    set_noise(point, handle->config.range, result.stddev / lsb, (float)(result.max_raw - result.min_raw));
+    return ADS1115_OK;
+}
+
+/**
+ * @brief Conversions needed to bring @p noise down to @p target by averaging.
+ */
+static uint32_t oversample_for(float noise, float target)
+{
+    if (target <= 0.0f || noise <= target)
+        return 1U;
+    float ratio = noise / target;
+    float n = ceilf(ratio * ratio);
+    return n > (float)ADS1115_CHAR_MAX_OVERSAMPLE ? ADS1115_CHAR_MAX_OVERSAMPLE + 1U : (uint32_t)n;
+}
+
+/*===========================================================================*/
+/* PUBLIC API IMPLEMENTATIONS                                                */
+/*===========================================================================*/
+
+ads1115_error_t ads1115_characterize_measure(ads1115_handle_t *handle, ads1115_mux_t mux, uint16_t samples, ads1115_char_table_t *table)
+{
+    if (handle == NULL || table == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (!handle->is_initialized)
+        return ADS1115_ERROR_NOT_INITIALIZED;
+    if (mux > ADS1115_MUX_AIN3_GND || samples < 2U || handle->config.mode != ADS1115_MODE_SINGLE_SHOT)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    ads1115_config_t saved = handle->config;
+    ads1115_error_t err = ADS1115_OK;
+    table->mux = mux;
+    table->measured = true;
+    handle->config.mux = mux;
+    for (int range = 0; range < ADS1115_CHAR_RANGES && err == ADS1115_OK; range++)
+    {
+        for (int rate = 0; rate < ADS1115_CHAR_RATES && err == ADS1115_OK; rate++)
+        {
+            handle->config.range = (ads1115_range_t)range;
+            handle->config.data_rate = (ads1115_data_rate_t)rate;
+            err = measure_point(handle, samples, &table->points[range][rate]);
+        }
+    }
+    handle->config = saved;
+    return err;
+}
+
+ads1115_error_t ads1115_characterize_model(ads1115_mux_t mux, float signal_peak, ads1115_char_table_t *table)
+{
+    if (table == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (mux > ADS1115_MUX_AIN3_GND)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    table->mux = mux;
+    table->measured = false;
+    for (int range = 0; range < ADS1115_CHAR_RANGES; range++)
+    {
+        float full_scale;
+        ads1115_raw_to_voltage((ads1115_range_t)range, INT16_MAX, &full_scale);
+        for (int rate = 0; rate < ADS1115_CHAR_RATES; rate++)
+        {
+            ads1115_char_point_t *point = &table->points[range][rate];
+            float rms_uv, pp_uv;
+            ads1115_get_noise_uv((ads1115_range_t)range, (ads1115_data_rate_t)rate, &rms_uv, &pp_uv);
+            if (pp_uv / CHAR_CREST_FACTOR > rms_uv)
+                rms_uv = pp_uv / CHAR_CREST_FACTOR;
+
+            point->usable = fabsf(signal_peak) < full_scale;
+            point->mean = 0.0f;
+            ads1115_get_conversion_time_us((ads1115_data_rate_t)rate, &point->time_us);
+            float lsb = lsb_uv((ads1115_range_t)range);
+            set_noise(point, (ads1115_range_t)range, rms_uv / lsb, pp_uv / lsb);
+        }
+    }
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_characterize_recommend(const ads1115_char_table_t *table, float target_rms_uv, float target_pp_uv,
+                                               ads1115_char_recommendation_t *rec)
+{
+    if (table == NULL || rec == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+
+    bool found = false;
+    uint64_t best_time = 0;
+    uint32_t best_n = 0;
+    for (int range = 0; range < ADS1115_CHAR_RANGES; range++)
+    {
+        for (int rate = 0; rate < ADS1115_CHAR_RATES; rate++)
+        {
+            const ads1115_char_point_t *point = &table->points[range][rate];
+            if (!point->usable)
+                continue;
+            uint32_t n = oversample_for(point->noise_rms_uv, target_rms_uv);
+            uint32_t n_pp = oversample_for(point->noise_pp_uv, target_pp_uv);
+            if (n_pp > n)
+                n = n_pp;
+            if (n > ADS1115_CHAR_MAX_OVERSAMPLE)
+                continue;
+
+            /* Ranges are visited widest first, so equal cost keeps the wider one */
+            uint64_t time = (uint64_t)n * point->time_us;
+            if (found && (time > best_time || (time == best_time && n >= best_n)))
+                continue;
+
+            found = true;
+            best_time = time;
+            best_n = n;
+            float scale = 1.0f / sqrtf((float)n);
+            rec->mux = table->mux;
+            rec->range = (ads1115_range_t)range;
+            rec->data_rate = (ads1115_data_rate_t)rate;
+            rec->oversample = (uint16_t)n;
+            rec->noise_rms_uv = point->noise_rms_uv * scale;
+            rec->noise_pp_uv = point->noise_pp_uv * scale;
+            rec->time_us = time > UINT32_MAX ? UINT32_MAX : (uint32_t)time;
+        }
+    }
+    return found ? ADS1115_OK : ADS1115_ERROR_INVALID_PARAM;
+}
+
+ads1115_error_t ads1115_characterize_apply(const ads1115_char_recommendation_t *rec, ads1115_config_t *config)
+{
+    if (rec == NULL || config == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (rec->mux > ADS1115_MUX_AIN3_GND || rec->range > ADS1115_RANGE_0V256 || rec->data_rate > ADS1115_DR_860_SPS)
+        return ADS1115_ERROR_INVALID_PARAM;
+    config->mux = rec->mux;
+    config->range = rec->range;
+    config->data_rate = rec->data_rate;
+    return ADS1115_OK;
+}
+
+/** @} */ // End of ADS1115_Characterize
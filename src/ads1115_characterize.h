@@ -0,0 +1,137 @@
+/**
+ * @file ads1115_characterize.h
+ * @brief ADS1115 Noise/Rate Characterisation - Header File
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ *
+ * @details Runs one channel through every range/data rate combination, either on
+ * the device (with a quiet, stable input) or on the datasheet noise model, and
+ * records noise RMS, peak-to-peak noise, effective resolution and time cost per
+ * combination. From that table it recommends the range, data rate and number of
+ * averaged conversions that reach a target noise floor in the least time; the
+ * recommendation is applied to an @ref ads1115_config_t at startup.
+ */
+
+#ifndef ADS1115_CHARACTERIZE_H
+#define ADS1115_CHARACTERIZE_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include "ads1115.h"
+
+/**
+ * @defgroup ADS1115_Characterize Noise/Rate Characterisation
+ * @ingroup ADS1115_Driver
+ * @brief Measured or modeled noise per range/data rate and configuration advice.
+ * @{
+ */
+
+/** @brief Number of @ref ads1115_range_t values. */
+#define ADS1115_CHAR_RANGES 6
+
+/** @brief Number of @ref ads1115_data_rate_t values. */
+#define ADS1115_CHAR_RATES 8
+
+/** @brief Largest number of averaged conversions a recommendation may use. */
+#ifndef ADS1115_CHAR_MAX_OVERSAMPLE
+#define ADS1115_CHAR_MAX_OVERSAMPLE 256U
+#endif
+
+/**
+ * @brief Figures of one range/data rate combination.
+ */
+typedef struct
+{
+    bool usable;           /**< Signal fits the range without clipping */
+    float mean;            /**< Mean input, scaled like @ref ads1115_single_read */
+    float noise_rms_uv;    /**< Input-referred RMS noise in microvolts */
+    float noise_pp_uv;     /**< Input-referred peak-to-peak noise in microvolts */
+    float effective_bits;  /**< log2(2 * FSR / RMS noise) */
+    float noise_free_bits; /**< log2(2 * FSR / peak-to-peak noise) */
+    uint32_t time_us;      /**< Conversion time per sample */
+} ads1115_char_point_t;
+
+/**
+ * @brief Characterisation of one channel.
+ */
+typedef struct
+{
+    ads1115_mux_t mux;                                                    /**< Characterised input */
+    bool measured;                                                        /**< Figures come from the device, not the model */
+    ads1115_char_point_t points[ADS1115_CHAR_RANGES][ADS1115_CHAR_RATES]; /**< Indexed [range][data_rate] */
+} ads1115_char_table_t;
+
+/**
+ * @brief Recommended configuration of a channel.
+ */
+typedef struct
+{
+    ads1115_mux_t mux;             /**< Input multiplexer selection */
+    ads1115_range_t range;         /**< Full-scale range */
+    ads1115_data_rate_t data_rate; /**< Data rate */
+    uint16_t oversample;           /**< Conversions to average per output sample (1 = none) */
+    float noise_rms_uv;            /**< Expected RMS noise after averaging */
+    float noise_pp_uv;             /**< Expected peak-to-peak noise after averaging */
+    uint32_t time_us;              /**< Conversion time per output sample */
+} ads1115_char_recommendation_t;
+
+/**
+ * @brief Measures every combination on the device.
+ * @details Takes @p samples single-shot conversions per combination (48 in total)
+ * through the handle, which must be in single-shot mode. The input must be stable
+ * during the run; any signal variation is counted as noise. The handle
+ * configuration is restored afterwards (the device keeps the last combination
+ * until the next conversion is started).
+ * @param handle Initialized device handle.
+ * @param mux Input to characterise.
+ * @param samples Conversions per combination (at least 2).
+ * @param[out] table Pointer to store the results.
+ * @return @ref ads1115_error_t result of the first failing bus operation.
+ */
+ads1115_error_t ads1115_characterize_measure(ads1115_handle_t *handle, ads1115_mux_t mux, uint16_t samples, ads1115_char_table_t *table);
+
+/**
+ * @brief Fills the table from the datasheet noise model.
+ * @details RMS noise is the larger of the datasheet RMS figure and the
+ * peak-to-peak figure divided by 6.6 (Gaussian crest factor).
+ * @param mux Input the table is for.
+ * @param signal_peak Largest expected input magnitude, in the unit of @ref ads1115_single_read.
+ * @param[out] table Pointer to store the results.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_characterize_model(ads1115_mux_t mux, float signal_peak, ads1115_char_table_t *table);
+
+/**
+ * @brief Picks the fastest configuration that reaches a noise target.
+ * @details For every usable combination the number of averaged conversions needed
+ * to reach the target is computed (noise assumed white, falling with the square
+ * root of the count); the combination with the shortest time per output sample
+ * wins, ties going to fewer conversions and then to the wider range.
+ * @param table Characterisation table.
+ * @param target_rms_uv RMS noise target in microvolts, 0 for none.
+ * @param target_pp_uv Peak-to-peak noise target in microvolts, 0 for none.
+ * @param[out] rec Pointer to store the recommendation.
+ * @return ADS1115_ERROR_INVALID_PARAM if no combination reaches the target within
+ * @ref ADS1115_CHAR_MAX_OVERSAMPLE conversions.
+ */
+ads1115_error_t ads1115_characterize_recommend(const ads1115_char_table_t *table, float target_rms_uv, float target_pp_uv,
+                                               ads1115_char_recommendation_t *rec);
+
+/**
+ * @brief Loads a recommendation into a configuration (MUX, range, data rate).
+ * @param rec Recommendation.
+ * @param[out] config Configuration to update; other fields are left untouched.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_characterize_apply(const ads1115_char_recommendation_t *rec, ads1115_config_t *config);
+
+/** @} */ // End of ADS1115_Characterize
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADS1115_CHARACTERIZE_H */
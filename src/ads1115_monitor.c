@@ -0,0 +1,281 @@
+/**
+ * @file ads1115_monitor.c
+ * @brief ADS1115 Comparator-Offloaded Threshold Monitor - Implementation File
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ */
+
+#include "ads1115_monitor.h"
+#include <stddef.h>
+
+/**
+ * @addtogroup ADS1115_Monitor
+ * @{
+ */
+
+/*===========================================================================*/
+/* PRIVATE CONSTANTS                                                         */
+/*===========================================================================*/
+
+/** @brief Number of conversions needed before the comparator reflects a new MUX setting */
+#define MONITOR_SETTLE_CONVERSIONS 2U
+
+/** @brief Conversions out of window before ALERT asserts, indexed by @ref ads1115_comp_queue_t */
+static const uint8_t MONITOR_QUEUE_LENGTH[] = {1, 2, 4};
+
+/*===========================================================================*/
+/* PRIVATE FUNCTIONS                                                         */
+/*===========================================================================*/
+
+/**
+ * @brief Worst-case conversion time of the monitor data rate.
+ */
+static uint32_t worst_conversion_us(const ads1115_monitor_t *mon)
+{
+    uint32_t worst = 0;
+    ads1115_get_conversion_time_max_us(mon->data_rate, &worst);
+    return worst;
+}
+
+/**
+ * @brief Time after arming until the Conversion register holds data of the new channel.
+ */
+static uint32_t settle_us(const ads1115_monitor_t *mon)
+{
+    return MONITOR_SETTLE_CONVERSIONS * worst_conversion_us(mon);
+}
+
+/**
+ * @brief Settling plus the conversions the comparator queue needs to assert ALERT.
+ */
+static uint32_t detection_window_us(const ads1115_monitor_t *mon)
+{
+    return settle_us(mon) + MONITOR_QUEUE_LENGTH[mon->comp_queue] * worst_conversion_us(mon);
+}
+
+/**
+ * @brief Finds the next channel of the same device after @p from (cyclic).
+ */
+static uint8_t next_channel(const ads1115_monitor_t *mon, const ads1115_handle_t *handle, uint8_t from)
+{
+    for (uint8_t step = 1; step <= mon->channel_count; step++)
+    {
+        uint8_t i = (uint8_t)((from + step) % mon->channel_count);
+        if (mon->channels[i].handle == handle)
+            return i;
+    }
+    return from;
+}
+
+/**
+ * @brief Programs thresholds, MUX and comparator for a channel.
+ * @details Threshold registers are only rewritten when they differ from the values
+ * already on the device, so a rotation costs one to three register writes.
+ */
+static ads1115_error_t arm_channel(ads1115_monitor_t *mon, ads1115_monitor_device_t *dev, uint8_t index, uint32_t now_us)
+{
+    const ads1115_monitor_channel_t *ch = &mon->channels[index];
+    ads1115_handle_t *handle = dev->handle;
+    ads1115_error_t err;
+
+    if (handle->config.low_threshold != ch->low_threshold || handle->config.high_threshold != ch->high_threshold)
+    {
+        if ((err = ads1115_set_compare_threshold(handle, ch->low_threshold, ch->high_threshold)) != ADS1115_OK)
+            return err;
+    }
+
+    handle->config.mux = ch->mux;
+    handle->config.range = ch->range;
+    handle->config.data_rate = mon->data_rate;
+    handle->config.comp_mode = ADS1115_COMP_MODE_WINDOW;
+    handle->config.comp_pol = mon->comp_pol;
+    handle->config.comp_latch = ADS1115_COMP_LAT_LATCHING;
+    handle->config.comp_queue = mon->comp_queue;
+    if ((err = ads1115_continuous_conversion_start(handle)) != ADS1115_OK)
+        return err;
+
+    dev->current = index;
+    dev->switched_us = now_us;
+    return ADS1115_OK;
+}
+
+/*===========================================================================*/
+/* PUBLIC API IMPLEMENTATIONS                                                */
+/*===========================================================================*/
+
+ads1115_error_t ads1115_monitor_init(ads1115_monitor_t *mon, ads1115_monitor_channel_t *channels, uint8_t channel_count,
+                                     ads1115_data_rate_t data_rate, ads1115_comp_queue_t comp_queue, uint32_t dwell_us,
+                                     ads1115_monitor_excursion_t on_excursion, void *user_data)
+{
+    if (mon == NULL || channels == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (channel_count == 0 || channel_count >= ADS1115_MONITOR_NO_CHANNEL)
+        return ADS1115_ERROR_INVALID_PARAM;
+    if (data_rate > ADS1115_DR_860_SPS || comp_queue >= ADS1115_COMP_QUE_DISABLE)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    mon->channels = channels;
+    mon->channel_count = channel_count;
+    mon->data_rate = data_rate;
+    mon->comp_queue = comp_queue;
+    mon->comp_pol = ADS1115_COMP_POL_ACTIVE_LOW;
+    mon->on_excursion = on_excursion;
+    mon->read_alert = NULL;
+    mon->user_data = user_data;
+    mon->device_count = 0;
+    mon->is_running = false;
+
+    uint32_t min_dwell = detection_window_us(mon);
+    mon->dwell_us = dwell_us > min_dwell ? dwell_us : min_dwell;
+
+    for (uint8_t i = 0; i < channel_count; i++)
+    {
+        ads1115_monitor_channel_t *ch = &channels[i];
+        if (ch->handle == NULL)
+            return ADS1115_ERROR_NULL_POINTER;
+        if (ch->mux > ADS1115_MUX_AIN3_GND || ch->range > ADS1115_RANGE_0V256 || ch->low_threshold > ch->high_threshold)
+            return ADS1115_ERROR_INVALID_PARAM;
+        ch->excursions = 0;
+
+        uint8_t d;
+        for (d = 0; d < mon->device_count; d++)
+        {
+            if (mon->devices[d].handle == ch->handle)
+                break;
+        }
+        if (d == mon->device_count)
+        {
+            if (mon->device_count >= ADS1115_MONITOR_MAX_DEVICES)
+                return ADS1115_ERROR_INVALID_PARAM;
+            mon->devices[d].handle = ch->handle;
+            mon->devices[d].current = i;
+            mon->devices[d].channel_count = 0;
+            mon->devices[d].switched_us = 0;
+            mon->devices[d].alert_pending = false;
+            mon->devices[d].alert_us = 0;
+            mon->devices[d].spurious = 0;
+            mon->device_count++;
+        }
+        mon->devices[d].channel_count++;
+    }
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_monitor_start(ads1115_monitor_t *mon, uint32_t now_us)
+{
+    if (mon == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+
+    for (uint8_t d = 0; d < mon->device_count; d++)
+    {
+        ads1115_monitor_device_t *dev = &mon->devices[d];
+        dev->alert_pending = false;
+        ads1115_error_t err = arm_channel(mon, dev, dev->current, now_us);
+        if (err != ADS1115_OK)
+            return err;
+    }
+    mon->is_running = true;
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_monitor_stop(ads1115_monitor_t *mon)
+{
+    if (mon == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+
+    mon->is_running = false;
+    for (uint8_t d = 0; d < mon->device_count; d++)
+    {
+        ads1115_handle_t *handle = mon->devices[d].handle;
+        handle->config.comp_queue = ADS1115_COMP_QUE_DISABLE;
+        ads1115_error_t err = ads1115_continuous_conversion_stop(handle);
+        if (err != ADS1115_OK)
+            return err;
+    }
+    return ADS1115_OK;
+}
+
+void ads1115_monitor_alert_isr(ads1115_monitor_t *mon, const ads1115_handle_t *handle, uint32_t now_us)
+{
+    for (uint8_t d = 0; d < mon->device_count; d++)
+    {
+        if (mon->devices[d].handle == handle)
+        {
+            mon->devices[d].alert_us = now_us;
+            mon->devices[d].alert_pending = true;
+            return;
+        }
+    }
+}
+
+ads1115_error_t ads1115_monitor_poll(ads1115_monitor_t *mon, uint32_t now_us)
+{
+    if (mon == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (!mon->is_running)
+        return ADS1115_ERROR_NOT_INITIALIZED;
+
+    for (uint8_t d = 0; d < mon->device_count; d++)
+    {
+        ads1115_monitor_device_t *dev = &mon->devices[d];
+        ads1115_error_t err;
+
+        if (!dev->alert_pending && mon->read_alert && mon->read_alert(dev->handle))
+        {
+            dev->alert_us = now_us;
+            dev->alert_pending = true;
+        }
+
+        if (dev->alert_pending && ads1115_time_reached(now_us, dev->switched_us + settle_us(mon)))
+        {
+            int16_t raw;
+            float voltage;
+            dev->alert_pending = false;
+            /* Reading the Conversion register also clears the latched ALERT */
+            if ((err = ads1115_continuous_conversion_read(dev->handle, &raw, &voltage)) != ADS1115_OK)
+                return err;
+
+            /* Only alerts raised before settling can stem from a conversion that straddled the switch */
+            ads1115_monitor_channel_t *ch = &mon->channels[dev->current];
+            if (ads1115_time_reached(dev->alert_us, dev->switched_us + settle_us(mon)))
+            {
+                ch->excursions++;
+                if (mon->on_excursion)
+                    mon->on_excursion(dev->current, raw, voltage, now_us, mon->user_data);
+            }
+            else
+            {
+                dev->spurious++;
+            }
+        }
+
+        if (dev->channel_count > 1 && !dev->alert_pending && ads1115_time_reached(now_us, dev->switched_us + mon->dwell_us))
+        {
+            uint8_t next = next_channel(mon, dev->handle, dev->current);
+            if ((err = arm_channel(mon, dev, next, now_us)) != ADS1115_OK)
+                return err;
+        }
+    }
+    return ADS1115_OK;
+}
+
+uint32_t ads1115_monitor_worst_latency_us(const ads1115_monitor_t *mon, uint8_t channel_index)
+{
+    if (mon == NULL || channel_index >= mon->channel_count)
+        return 0;
+
+    const ads1115_handle_t *handle = mon->channels[channel_index].handle;
+    for (uint8_t d = 0; d < mon->device_count; d++)
+    {
+        const ads1115_monitor_device_t *dev = &mon->devices[d];
+        if (dev->handle != handle)
+            continue;
+        if (dev->channel_count == 1)
+            return MONITOR_QUEUE_LENGTH[mon->comp_queue] * worst_conversion_us(mon);
+        return (uint32_t)(dev->channel_count - 1U) * mon->dwell_us + detection_window_us(mon);
+    }
+    return 0;
+}
+
+/** @} */ // End of ADS1115_Monitor
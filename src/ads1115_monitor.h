@@ -0,0 +1,174 @@
+/**
+ * @file ads1115_monitor.h
+ * @brief ADS1115 Comparator-Offloaded Threshold Monitor - Header File
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ *
+ * @details Watches many channels for excursions without polling conversion data.
+ * Each device runs in continuous mode with the window comparator latched; the
+ * monitor rotates the MUX and the threshold registers through the channels of
+ * the device and only reads the Conversion register when the ALERT/RDY pin fires.
+ * A device with a single channel generates no bus traffic while it stays quiet.
+ */
+
+#ifndef ADS1115_MONITOR_H
+#define ADS1115_MONITOR_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include "ads1115.h"
+
+/**
+ * @defgroup ADS1115_Monitor Threshold Monitor
+ * @ingroup ADS1115_Driver
+ * @brief Hardware comparator based excursion detection across many channels.
+ * @{
+ */
+
+/** @brief Maximum number of devices handled by one monitor instance. */
+#ifndef ADS1115_MONITOR_MAX_DEVICES
+#define ADS1115_MONITOR_MAX_DEVICES 4
+#endif
+
+/** @brief Marker for "no channel". */
+#define ADS1115_MONITOR_NO_CHANNEL 0xFF
+
+/**
+ * @brief Monitored channel description and statistics.
+ */
+typedef struct
+{
+    ads1115_handle_t *handle; /**< Device this channel lives on */
+    ads1115_mux_t mux;        /**< Input multiplexer selection */
+    ads1115_range_t range;    /**< Full-scale range */
+    int16_t low_threshold;    /**< Window low bound (raw code) */
+    int16_t high_threshold;   /**< Window high bound (raw code) */
+    uint32_t excursions;      /**< Number of confirmed excursions (maintained by the monitor) */
+} ads1115_monitor_channel_t;
+
+/**
+ * @brief Callback invoked for every confirmed excursion.
+ * @param channel_index Index into the channel table.
+ * @param adc_raw Conversion result read after the alert; back inside the window if
+ * the excursion ended before it was read.
+ * @param voltage Converted voltage, scaled like @ref ads1115_single_read.
+ * @param timestamp_us Time at which the excursion was read.
+ * @param user_data Opaque pointer given to the monitor.
+ */
+typedef void (*ads1115_monitor_excursion_t)(uint8_t channel_index, int16_t adc_raw, float voltage, uint32_t timestamp_us, void *user_data);
+
+/**
+ * @brief Optional ALERT/RDY pin sampler.
+ * @param handle Device whose ALERT/RDY pin is queried.
+ * @return true if the pin is in its active state.
+ */
+typedef bool (*ads1115_monitor_alert_t)(ads1115_handle_t *handle);
+
+/**
+ * @brief Per-device rotation state.
+ */
+typedef struct
+{
+    ads1115_handle_t *handle;    /**< Device handle */
+    uint8_t current;             /**< Channel currently armed in the comparator */
+    uint8_t channel_count;       /**< Number of channels on this device */
+    uint32_t switched_us;        /**< Time the current channel was armed */
+    volatile bool alert_pending; /**< Set from the ALERT/RDY interrupt */
+    volatile uint32_t alert_us;  /**< Time the pending alert was raised */
+    uint32_t spurious;           /**< Alerts raised before the current channel had settled */
+} ads1115_monitor_device_t;
+
+/**
+ * @brief Monitor instance.
+ */
+typedef struct
+{
+    ads1115_monitor_channel_t *channels;                       /**< Application-owned channel table */
+    uint8_t channel_count;                                     /**< Number of entries in the table */
+    ads1115_data_rate_t data_rate;                             /**< Conversion rate used while monitoring */
+    ads1115_comp_queue_t comp_queue;                           /**< Conversions out of window before ALERT asserts */
+    ads1115_comp_polarity_t comp_pol;                          /**< ALERT/RDY pin polarity */
+    uint32_t dwell_us;                                         /**< Time each channel stays armed */
+    ads1115_monitor_excursion_t on_excursion;                  /**< Excursion callback */
+    ads1115_monitor_alert_t read_alert;                        /**< Optional pin sampler, NULL if interrupt driven */
+    void *user_data;                                           /**< Passed to @ref on_excursion */
+    ads1115_monitor_device_t devices[ADS1115_MONITOR_MAX_DEVICES]; /**< Devices discovered from the channel table */
+    uint8_t device_count;                                      /**< Number of used device slots */
+    bool is_running;                                           /**< Set by @ref ads1115_monitor_start */
+} ads1115_monitor_t;
+
+/**
+ * @brief Initializes the monitor with a channel table.
+ * @details The dwell time is raised if needed so that every armed channel sees at
+ * least one full settled comparison window (settling plus the comparator queue).
+ * @param mon Pointer to the monitor instance.
+ * @param channels Channel table (kept by reference).
+ * @param channel_count Number of channels.
+ * @param data_rate Data rate used for all monitored conversions.
+ * @param comp_queue Comparator queue setting (must not be disabled).
+ * @param dwell_us Requested dwell per channel in microseconds.
+ * @param on_excursion Excursion callback (may be NULL).
+ * @param user_data Opaque pointer handed to the callback.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_monitor_init(ads1115_monitor_t *mon, ads1115_monitor_channel_t *channels, uint8_t channel_count,
+                                     ads1115_data_rate_t data_rate, ads1115_comp_queue_t comp_queue, uint32_t dwell_us,
+                                     ads1115_monitor_excursion_t on_excursion, void *user_data);
+
+/**
+ * @brief Arms the first channel of every device and starts continuous conversion.
+ * @param mon Pointer to the monitor instance.
+ * @param now_us Current time in microseconds.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_monitor_start(ads1115_monitor_t *mon, uint32_t now_us);
+
+/**
+ * @brief Stops monitoring and returns every device to single-shot (power-down).
+ * @param mon Pointer to the monitor instance.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_monitor_stop(ads1115_monitor_t *mon);
+
+/**
+ * @brief Records an ALERT/RDY edge for a device; safe to call from an ISR.
+ * @param mon Pointer to the monitor instance.
+ * @param handle Device whose ALERT/RDY pin fired.
+ * @param now_us Time of the edge, on the same clock as @ref ads1115_monitor_poll.
+ */
+void ads1115_monitor_alert_isr(ads1115_monitor_t *mon, const ads1115_handle_t *handle, uint32_t now_us);
+
+/**
+ * @brief Services alerts and channel rotation; never blocks.
+ * @details An alert is handled once the armed channel has settled: the Conversion
+ * register is read, which also clears the latch. Alerts raised before the channel
+ * had settled may stem from a conversion that straddled a MUX switch and are
+ * counted as spurious; later ones are reported even if the value has recovered.
+ * Alerts seen through @ref ads1115_monitor_t::read_alert are timed by the poll that
+ * samples the pin, so poll within the settling time after every channel switch.
+ * @param mon Pointer to the monitor instance.
+ * @param now_us Current time in microseconds (wrap-around safe).
+ * @return @ref ads1115_error_t result of the first failing bus operation.
+ */
+ads1115_error_t ads1115_monitor_poll(ads1115_monitor_t *mon, uint32_t now_us);
+
+/**
+ * @brief Worst-case excursion detection latency for a channel.
+ * @details A full rotation through the other channels of the device plus settling
+ * and the comparator queue of the channel itself.
+ * @param mon Pointer to the monitor instance.
+ * @param channel_index Index into the channel table.
+ * @return Latency bound in microseconds, 0 for an invalid index.
+ */
+uint32_t ads1115_monitor_worst_latency_us(const ads1115_monitor_t *mon, uint8_t channel_index);
+
+/** @} */ // End of ADS1115_Monitor
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADS1115_MONITOR_H */
@@ -0,0 +1,179 @@
+/**
+ * @file ads1115_pipeline.c
+ * @brief ADS1115 Pipelined Single-Shot Conversions - Implementation File
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ */
+
+#include "ads1115_pipeline.h"
+#include "ads1115_planner.h"
+#include <stddef.h>
+
+/**
+ * @addtogroup ADS1115_Pipeline
+ * @{
+ */
+
+/*===========================================================================*/
+/* PRIVATE FUNCTIONS                                                         */
+/*===========================================================================*/
+
+/**
+ * @brief Earliest time at which the running conversion may be complete.
+ * @details The conversion only starts once the start write has left the bus.
+ */
+static uint32_t due_time(const ads1115_pipeline_t *pipe)
+{
+    return pipe->started_us + pipe->start_bus_us + pipe->wait_us;
+}
+
+/**
+ * @brief Loads the settings of the next step into the handle.
+ */
+static void load_next(ads1115_pipeline_t *pipe)
+{
+    const ads1115_pipeline_step_t *step = &pipe->steps[pipe->next_step];
+    ads1115_handle_t *handle = pipe->handle;
+
+    handle->config.mux = step->mux;
+    handle->config.range = step->range;
+    handle->config.data_rate = step->data_rate;
+}
+
+/**
+ * @brief Records that the conversion of the next step has been started.
+ */
+static void mark_started(ads1115_pipeline_t *pipe, uint32_t now_us)
+{
+    const ads1115_pipeline_step_t *step = &pipe->steps[pipe->next_step];
+
+    /* Timed mode must cover the slowest oscillator; polling starts checking at nominal */
+    if (pipe->ready_mode == ADS1115_PIPELINE_READY_TIMED)
+        ads1115_get_conversion_time_max_us(step->data_rate, &pipe->wait_us);
+    else
+        ads1115_get_conversion_time_us(step->data_rate, &pipe->wait_us);
+    pipe->active_step = pipe->next_step;
+    pipe->next_step = (uint8_t)((pipe->next_step + 1U) % pipe->step_count);
+    pipe->started_us = now_us;
+    pipe->active = true;
+    if (!pipe->endless)
+        pipe->remaining--;
+}
+
+/*===========================================================================*/
+/* PUBLIC API IMPLEMENTATIONS                                                */
+/*===========================================================================*/
+
+ads1115_error_t ads1115_pipeline_init(ads1115_pipeline_t *pipe, ads1115_handle_t *handle, const ads1115_pipeline_step_t *steps,
+                                      uint8_t step_count, ads1115_pipeline_result_t on_result, void *user_data)
+{
+    if (pipe == NULL || handle == NULL || steps == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (!handle->is_initialized)
+        return ADS1115_ERROR_NOT_INITIALIZED;
+    if (step_count == 0 || handle->config.mode != ADS1115_MODE_SINGLE_SHOT)
+        return ADS1115_ERROR_INVALID_PARAM;
+    for (uint8_t i = 0; i < step_count; i++)
+    {
+        if (steps[i].mux > ADS1115_MUX_AIN3_GND || steps[i].range > ADS1115_RANGE_0V256 ||
+            steps[i].data_rate > ADS1115_DR_860_SPS)
+            return ADS1115_ERROR_INVALID_PARAM;
+    }
+
+    pipe->handle = handle;
+    pipe->steps = steps;
+    pipe->step_count = step_count;
+    pipe->ready_mode = ADS1115_PIPELINE_READY_TIMED;
+    ads1115_bus_model_t bus = {400000U, 0U, false};
+    ads1115_op_cost_t start;
+    ads1115_planner_op_cost(&bus, ADS1115_OP_SINGLE_START, ADS1115_DR_128_SPS, &start);
+    pipe->start_bus_us = start.bus_us;
+    pipe->on_result = on_result;
+    pipe->user_data = user_data;
+    pipe->remaining = 0;
+    pipe->endless = false;
+    pipe->active = false;
+    pipe->active_step = 0;
+    pipe->next_step = 0;
+    pipe->wait_us = 0;
+    pipe->started_us = 0;
+    pipe->conversions = 0;
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_pipeline_start(ads1115_pipeline_t *pipe, uint32_t count, uint32_t now_us)
+{
+    if (pipe == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (pipe->active)
+        return ADS1115_ERROR_CONVERSION_BUSY;
+
+    pipe->endless = count == 0U;
+    pipe->remaining = count;
+    load_next(pipe);
+    ads1115_error_t err = ads1115_single_start(pipe->handle);
+    if (err != ADS1115_OK)
+        return err;
+    mark_started(pipe, now_us);
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_pipeline_stop(ads1115_pipeline_t *pipe)
+{
+    if (pipe == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    pipe->endless = false;
+    pipe->remaining = 0;
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_pipeline_service(ads1115_pipeline_t *pipe, uint32_t now_us)
+{
+    if (pipe == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (!pipe->active || !ads1115_time_reached(now_us, due_time(pipe)))
+        return ADS1115_OK;
+
+    ads1115_error_t err;
+    if (pipe->ready_mode == ADS1115_PIPELINE_READY_POLL)
+    {
+        bool ready;
+        if ((err = ads1115_is_ready(pipe->handle, &ready)) != ADS1115_OK)
+            return err;
+        if (!ready)
+            return ADS1115_OK;
+    }
+
+    uint8_t finished = pipe->active_step;
+    pipe->active = false;
+
+    /* Start N+1 and read N under one bus claim: the Conversion register keeps result N until N+1 completes */
+    int16_t raw;
+    float voltage;
+    if (pipe->endless || pipe->remaining > 0U)
+    {
+        load_next(pipe);
+        if ((err = ads1115_single_start_collect(pipe->handle, &raw)) != ADS1115_OK)
+            return err;
+        mark_started(pipe, now_us);
+    }
+    else if ((err = ads1115_single_collect(pipe->handle, &raw, &voltage)) != ADS1115_OK)
+        return err;
+    ads1115_raw_to_voltage(pipe->steps[finished].range, raw, &voltage);
+
+    pipe->conversions++;
+    if (pipe->on_result)
+        pipe->on_result(finished, raw, voltage, now_us, pipe->user_data);
+    return ADS1115_OK;
+}
+
+uint32_t ads1115_pipeline_next_event_us(const ads1115_pipeline_t *pipe, uint32_t now_us)
+{
+    if (!pipe->active)
+        return now_us;
+    uint32_t due = due_time(pipe);
+    return ads1115_time_reached(now_us, due) ? now_us : due;
+}
+
+/** @} */ // End of ADS1115_Pipeline
@@ -0,0 +1,143 @@
+/**
+ * @file ads1115_pipeline.h
+ * @brief ADS1115 Pipelined Single-Shot Conversions - Header File
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ *
+ * @details @ref ads1115_single_read leaves the device idle while the bus works and
+ * the bus idle while the device converts. In pipelined mode every service step
+ * starts conversion N+1 (with its own MUX/range/data rate) and reads the result
+ * of conversion N right after it with @ref ads1115_single_start_collect: the
+ * Conversion register keeps the previous result until the new conversion
+ * completes, so the device is converting for all but one register write per
+ * sample. After the last conversion of a burst the device powers down exactly
+ * as in plain single-shot mode.
+ *
+ * Both transactions run under one bus claim, so other handles on a shared bus
+ * cannot push the read past the new conversion. The calling thread itself must
+ * not be preempted between them for longer than one conversion time (about
+ * 1 ms at 860 SPS).
+ */
+
+#ifndef ADS1115_PIPELINE_H
+#define ADS1115_PIPELINE_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include "ads1115.h"
+
+/**
+ * @defgroup ADS1115_Pipeline Pipelined Single-Shot
+ * @ingroup ADS1115_Driver
+ * @brief Back-to-back single-shot conversions overlapping bus and conversion time.
+ * @{
+ */
+
+/**
+ * @brief Settings of one conversion in the sequence.
+ */
+typedef struct
+{
+    ads1115_mux_t mux;             /**< Input multiplexer selection */
+    ads1115_range_t range;         /**< Full-scale range */
+    ads1115_data_rate_t data_rate; /**< Data rate */
+} ads1115_pipeline_step_t;
+
+/**
+ * @brief Callback invoked for every collected result.
+ * @param step_index Index into the step sequence the result belongs to.
+ * @param adc_raw Raw conversion result.
+ * @param voltage Converted with the range of that step.
+ * @param timestamp_us Time at which the result was collected.
+ * @param user_data Opaque pointer given to the pipeline.
+ */
+typedef void (*ads1115_pipeline_result_t)(uint8_t step_index, int16_t adc_raw, float voltage, uint32_t timestamp_us, void *user_data);
+
+/**
+ * @brief How completion of the running conversion is detected.
+ */
+typedef enum
+{
+    ADS1115_PIPELINE_READY_TIMED = 0, /**< Worst-case conversion time elapsed (no extra bus traffic) */
+    ADS1115_PIPELINE_READY_POLL = 1,  /**< OS bit read back once the nominal time elapsed */
+} ads1115_pipeline_ready_t;
+
+/**
+ * @brief Pipeline state for one device.
+ */
+typedef struct
+{
+    ads1115_handle_t *handle;              /**< Device handle (must be in single-shot mode) */
+    const ads1115_pipeline_step_t *steps;  /**< Conversion sequence, cycled round-robin */
+    uint8_t step_count;                    /**< Number of steps */
+    ads1115_pipeline_ready_t ready_mode;   /**< Completion detection */
+    uint32_t start_bus_us;                 /**< Modeled start write time added to due times (400 kHz by default) */
+    ads1115_pipeline_result_t on_result;   /**< Result callback */
+    void *user_data;                       /**< Passed to @ref on_result */
+    uint32_t remaining;                    /**< Conversions still to start in this burst */
+    bool endless;                          /**< Burst started with a count of 0 */
+    bool active;                           /**< A conversion is running */
+    uint8_t active_step;                   /**< Step of the running conversion */
+    uint8_t next_step;                     /**< Step the next conversion will use */
+    uint32_t wait_us;                      /**< Time after the start write at which the running conversion is due */
+    uint32_t started_us;                   /**< Time the start write of the running conversion was issued */
+    uint32_t conversions;                  /**< Results collected since init */
+} ads1115_pipeline_t;
+
+/**
+ * @brief Initializes a pipeline on an initialized handle.
+ * @param pipe Pointer to the pipeline.
+ * @param handle Device handle.
+ * @param steps Conversion sequence (kept by reference).
+ * @param step_count Number of steps.
+ * @param on_result Result callback (may be NULL).
+ * @param user_data Opaque pointer handed to the callback.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_pipeline_init(ads1115_pipeline_t *pipe, ads1115_handle_t *handle, const ads1115_pipeline_step_t *steps,
+                                      uint8_t step_count, ads1115_pipeline_result_t on_result, void *user_data);
+
+/**
+ * @brief Starts a burst of back-to-back conversions.
+ * @param pipe Pointer to the pipeline.
+ * @param count Number of conversions, 0 for an endless burst.
+ * @param now_us Current time in microseconds.
+ * @return ADS1115_ERROR_CONVERSION_BUSY if a burst is still running.
+ */
+ads1115_error_t ads1115_pipeline_start(ads1115_pipeline_t *pipe, uint32_t count, uint32_t now_us);
+
+/**
+ * @brief Ends the burst after the running conversion; the device then powers down.
+ * @param pipe Pointer to the pipeline.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_pipeline_stop(ads1115_pipeline_t *pipe);
+
+/**
+ * @brief Services the pipeline; never blocks.
+ * @details Once the running conversion is complete, starts the next one (if the
+ * burst continues) and collects the finished result under the same bus claim.
+ * @param pipe Pointer to the pipeline.
+ * @param now_us Current time in microseconds (wrap-around safe).
+ * @return @ref ads1115_error_t result of the first failing bus operation.
+ */
+ads1115_error_t ads1115_pipeline_service(ads1115_pipeline_t *pipe, uint32_t now_us);
+
+/**
+ * @brief Time at which @ref ads1115_pipeline_service should be called next.
+ * @param pipe Pointer to the pipeline.
+ * @param now_us Current time in microseconds.
+ * @return Absolute time in microseconds, @p now_us if idle or already due.
+ */
+uint32_t ads1115_pipeline_next_event_us(const ads1115_pipeline_t *pipe, uint32_t now_us);
+
+/** @} */ // End of ADS1115_Pipeline
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADS1115_PIPELINE_H */
@@ -0,0 +1,203 @@
+/**
+ * @file ads1115_planner.c
+ * @brief ADS1115 Bus Throughput Planner and Capacity Model - Implementation File
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ */
+
+#include "ads1115_planner.h"
+#include <stddef.h>
+
+/**
+ * @addtogroup ADS1115_Planner
+ * @{
+ */
+
+/*===========================================================================*/
+/* PRIVATE CONSTANTS                                                         */
+/*===========================================================================*/
+
+/** @brief SCL clocks per byte: 8 data bits and ACK */
+#define PLAN_BYTE_CLOCKS 9U
+
+/** @brief Bytes of a register write: addr+W, pointer, MSB, LSB */
+#define PLAN_WRITE_BYTES 4U
+
+/** @brief Bytes of a register read: addr+W, pointer, addr+R, MSB, LSB */
+#define PLAN_READ_BYTES 5U
+
+/*===========================================================================*/
+/* PRIVATE FUNCTIONS                                                         */
+/*===========================================================================*/
+
+/**
+ * @brief Adds @p writes register writes and @p reads register reads to a cost.
+ * @details A write is S, 4 bytes, P. A read is S, 2 bytes, Sr, 3 bytes, P, or
+ * with @ref ads1115_bus_model_t::split_read two transactions S, 2 bytes, P and
+ * S, 3 bytes, P.
+ */
+static void add_transfers(const ads1115_bus_model_t *bus, ads1115_op_cost_t *cost, uint8_t writes, uint8_t reads)
+{
+    uint8_t read_txns = bus->split_read ? 2U : 1U;
+    uint8_t read_conditions = bus->split_read ? 4U : 3U;
+
+    cost->register_writes += writes;
+    cost->register_reads += reads;
+    cost->transactions += (uint8_t)(writes + reads * read_txns);
+    cost->bytes += (uint8_t)(writes * PLAN_WRITE_BYTES + reads * PLAN_READ_BYTES);
+    cost->clocks += (uint16_t)(writes * (PLAN_WRITE_BYTES * PLAN_BYTE_CLOCKS + 2U) +
+                               reads * (PLAN_READ_BYTES * PLAN_BYTE_CLOCKS + read_conditions));
+}
+
+/**
+ * @brief Device time per sample, bus time per sample and conversion-to-delivery
+ * time of a plan entry on an idle bus.
+ */
+static ads1115_error_t device_times(const ads1115_bus_model_t *bus, const ads1115_plan_device_t *dev, uint32_t *sample_us,
+                                    uint32_t *bus_us, uint32_t *own_us)
+{
+    ads1115_op_cost_t start, result, single;
+    ads1115_error_t err;
+    if ((err = ads1115_planner_op_cost(bus, ADS1115_OP_SINGLE_START, dev->data_rate, &start)) != ADS1115_OK)
+        return err;
+    if ((err = ads1115_planner_op_cost(bus, ADS1115_OP_READ_RESULT, dev->data_rate, &result)) != ADS1115_OK)
+        return err;
+    if ((err = ads1115_planner_op_cost(bus, ADS1115_OP_SINGLE_READ, dev->data_rate, &single)) != ADS1115_OK)
+        return err;
+
+    uint32_t nominal = 0, worst = 0;
+    ads1115_get_conversion_time_us(dev->data_rate, &nominal);
+    ads1115_get_conversion_time_max_us(dev->data_rate, &worst);
+
+    switch (dev->strategy)
+    {
+    case ADS1115_PLAN_BLOCKING:
+        /* Switching channels costs one config write before every read */
+        *bus_us = single.bus_us + (dev->channel_count > 1U ? start.bus_us : 0U);
+        *sample_us = *bus_us + single.wait_us;
+        *own_us = single.wait_us + result.bus_us;
+        break;
+    case ADS1115_PLAN_START_COLLECT:
+        *bus_us = start.bus_us + result.bus_us;
+        *sample_us = start.bus_us + worst + result.bus_us;
+        *own_us = *sample_us;
+        break;
+    case ADS1115_PLAN_PIPELINED:
+        /* The next due time is anchored after the start write of each step */
+        *bus_us = start.bus_us + result.bus_us;
+        *sample_us = start.bus_us + worst > *bus_us ? start.bus_us + worst : *bus_us;
+        *own_us = start.bus_us + worst + start.bus_us + result.bus_us;
+        break;
+    case ADS1115_PLAN_CONTINUOUS:
+        if (dev->channel_count != 1U)
+            return ADS1115_ERROR_INVALID_PARAM;
+        *bus_us = result.bus_us;
+        *sample_us = nominal > *bus_us ? nominal : *bus_us;
+        *own_us = nominal + result.bus_us;
+        break;
+    default:
+        return ADS1115_ERROR_INVALID_PARAM;
+    }
+    return ADS1115_OK;
+}
+
+/*===========================================================================*/
+/* PUBLIC API IMPLEMENTATIONS                                                */
+/*===========================================================================*/
+
+ads1115_error_t ads1115_planner_op_cost(const ads1115_bus_model_t *bus, ads1115_op_t op, ads1115_data_rate_t data_rate,
+                                        ads1115_op_cost_t *cost)
+{
+    if (bus == NULL || cost == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (bus->bus_clock_hz == 0 || data_rate > ADS1115_DR_860_SPS)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    cost->transactions = 0;
+    cost->register_writes = 0;
+    cost->register_reads = 0;
+    cost->bytes = 0;
+    cost->clocks = 0;
+    cost->wait_us = 0;
+
+    switch (op)
+    {
+    case ADS1115_OP_INIT:
+        add_transfers(bus, cost, 3U, 0U);
+        break;
+    case ADS1115_OP_WRITE_CONFIG:
+    case ADS1115_OP_SINGLE_START:
+        add_transfers(bus, cost, 1U, 0U);
+        break;
+    case ADS1115_OP_READ_CONFIG:
+    case ADS1115_OP_READ_RESULT:
+        add_transfers(bus, cost, 0U, 1U);
+        break;
+    case ADS1115_OP_SINGLE_READ:
+    {
+        /* Read config, write config with OS, delay whole milliseconds, read result */
+        uint32_t nominal = 0;
+        ads1115_get_conversion_time_us(data_rate, &nominal);
+        add_transfers(bus, cost, 1U, 2U);
+        cost->wait_us = (nominal / 1000U + 1U) * 1000U;
+        break;
+    }
+    case ADS1115_OP_SET_THRESHOLD:
+        add_transfers(bus, cost, 2U, 0U);
+        break;
+    default:
+        return ADS1115_ERROR_INVALID_PARAM;
+    }
+
+    uint32_t wire_us = (uint32_t)(((uint64_t)cost->clocks * 1000000U + bus->bus_clock_hz - 1U) / bus->bus_clock_hz);
+    cost->bus_us = wire_us + cost->transactions * bus->txn_overhead_us;
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_planner_evaluate(const ads1115_bus_model_t *bus, ads1115_plan_device_t *devices, uint8_t device_count,
+                                         ads1115_plan_report_t *report)
+{
+    if (bus == NULL || devices == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (device_count == 0)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    ads1115_plan_report_t local = {0};
+    uint64_t bus_total_us = 0;
+    for (uint8_t i = 0; i < device_count; i++)
+    {
+        ads1115_plan_device_t *dev = &devices[i];
+        if (dev->channel_count == 0 || dev->channel_count > 8U)
+            return ADS1115_ERROR_INVALID_PARAM;
+        ads1115_error_t err = device_times(bus, dev, &dev->sample_us, &dev->bus_us, &dev->result_us);
+        if (err != ADS1115_OK)
+            return err;
+        local.bus_demand += (float)dev->bus_us / (float)dev->sample_us;
+        bus_total_us += dev->bus_us;
+    }
+
+    /* An overloaded bus stretches every device's sample period by the same factor */
+    float stretch = local.bus_demand > 1.0f ? local.bus_demand : 1.0f;
+    local.bus_limited = local.bus_demand > 1.0f;
+    local.bus_utilization = local.bus_demand / stretch;
+
+    for (uint8_t i = 0; i < device_count; i++)
+    {
+        ads1115_plan_device_t *dev = &devices[i];
+        float period_us = (float)dev->sample_us * stretch;
+        dev->channel_rate_hz = 1000000.0f / (period_us * (float)dev->channel_count);
+        local.total_rate_hz += dev->channel_rate_hz * (float)dev->channel_count;
+
+        float latency = period_us * (float)dev->channel_count + (float)dev->result_us + (float)(bus_total_us - dev->bus_us);
+        dev->latency_us = latency < 4294967295.0f ? (uint32_t)(latency + 0.5f) : UINT32_MAX;
+        if (dev->latency_us > local.max_latency_us)
+            local.max_latency_us = dev->latency_us;
+    }
+
+    if (report)
+        *report = local;
+    return ADS1115_OK;
+}
+
+/** @} */ // End of ADS1115_Planner
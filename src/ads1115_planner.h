@@ -0,0 +1,146 @@
+/**
+ * @file ads1115_planner.h
+ * @brief ADS1115 Bus Throughput Planner and Capacity Model - Header File
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ *
+ * @details Models the exact I2C cost of every driver operation (transactions,
+ * bytes on the wire, SCL clocks and blocking waits) for a given bus clock, and
+ * combines it with the conversion times of the device into a capacity estimate
+ * for a board: achievable per-channel sample rates, bus utilization and
+ * worst-case latency for a set of devices and the strategy used to drive them.
+ * Conversion times are derated by the @f$\pm 10\%@f$ oscillator tolerance
+ * wherever the driver waits for a conversion by time.
+ */
+
+#ifndef ADS1115_PLANNER_H
+#define ADS1115_PLANNER_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include "ads1115.h"
+
+/**
+ * @defgroup ADS1115_Planner Throughput Planner
+ * @ingroup ADS1115_Driver
+ * @brief Bus cost model of driver operations and capacity planning.
+ * @{
+ */
+
+/**
+ * @brief Bus parameters of the model.
+ */
+typedef struct
+{
+    uint32_t bus_clock_hz;    /**< I2C SCL frequency, e.g. 400000 */
+    uint32_t txn_overhead_us; /**< Fixed HAL/software overhead and bus free time per transaction */
+    bool split_read;          /**< HAL sends a STOP after the pointer write instead of a repeated START */
+} ads1115_bus_model_t;
+
+/**
+ * @brief Driver operations with a bus cost.
+ */
+typedef enum
+{
+    ADS1115_OP_INIT = 0,           /**< @ref ads1115_init */
+    ADS1115_OP_WRITE_CONFIG = 1,   /**< set_range, set_data_rate, continuous start/stop */
+    ADS1115_OP_READ_CONFIG = 2,    /**< get_range, @ref ads1115_is_ready */
+    ADS1115_OP_SINGLE_READ = 3,    /**< @ref ads1115_single_read, including its delay */
+    ADS1115_OP_SINGLE_START = 4,   /**< @ref ads1115_single_start */
+    ADS1115_OP_READ_RESULT = 5,    /**< @ref ads1115_single_collect, @ref ads1115_continuous_conversion_read */
+    ADS1115_OP_SET_THRESHOLD = 6,  /**< @ref ads1115_set_compare_threshold */
+} ads1115_op_t;
+
+/**
+ * @brief Cost of one driver operation.
+ */
+typedef struct
+{
+    uint8_t transactions;    /**< I2C transactions (START ... STOP) */
+    uint8_t register_writes; /**< Register writes */
+    uint8_t register_reads;  /**< Register reads */
+    uint8_t bytes;           /**< Bytes on the wire, address bytes included */
+    uint16_t clocks;         /**< SCL clocks, START/STOP conditions counted as one each */
+    uint32_t bus_us;         /**< Bus time including per-transaction overhead, rounded up */
+    uint32_t wait_us;        /**< Time the driver blocks in delay_ms */
+} ads1115_op_cost_t;
+
+/**
+ * @brief How a device is driven.
+ */
+typedef enum
+{
+    ADS1115_PLAN_BLOCKING = 0,      /**< @ref ads1115_single_read loop (blocks the calling thread) */
+    ADS1115_PLAN_START_COLLECT = 1, /**< Start, wait the worst-case time, collect (scheduler) */
+    ADS1115_PLAN_PIPELINED = 2,     /**< Back-to-back single-shot (@ref ads1115_pipeline_t, timed) */
+    ADS1115_PLAN_CONTINUOUS = 3,    /**< Continuous mode, one read per conversion (single channel) */
+} ads1115_plan_strategy_t;
+
+/**
+ * @brief Per-device plan entry and model output.
+ * @details The first block is filled by the application; the remaining fields
+ * are written by @ref ads1115_planner_evaluate.
+ */
+typedef struct
+{
+    ads1115_plan_strategy_t strategy; /**< How the device is driven */
+    ads1115_data_rate_t data_rate;    /**< Data rate of every channel */
+    uint8_t channel_count;            /**< MUX settings visited round-robin (1..8) */
+
+    uint32_t sample_us;               /**< Device time per sample on an idle bus */
+    uint32_t bus_us;                  /**< Bus time per sample */
+    uint32_t result_us;               /**< Conversion start to delivered result on an idle bus */
+    float channel_rate_hz;            /**< Achievable sample rate of each channel */
+    uint32_t latency_us;              /**< Worst-case input change to delivered result */
+} ads1115_plan_device_t;
+
+/**
+ * @brief Bus-wide model output.
+ */
+typedef struct
+{
+    float bus_demand;        /**< Bus time requested per second of wall time (may exceed 1) */
+    float bus_utilization;   /**< Bus time actually used per second (at most 1) */
+    bool bus_limited;        /**< True if the bus, not the devices, limits the rates */
+    float total_rate_hz;     /**< Samples per second over all channels */
+    uint32_t max_latency_us; /**< Largest per-channel worst-case latency */
+} ads1115_plan_report_t;
+
+/**
+ * @brief Computes the cost of one driver operation.
+ * @param bus Bus model.
+ * @param op Operation.
+ * @param data_rate Data rate (only used for the wait of @ref ADS1115_OP_SINGLE_READ).
+ * @param[out] cost Pointer to store the cost.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_planner_op_cost(const ads1115_bus_model_t *bus, ads1115_op_t op, ads1115_data_rate_t data_rate,
+                                        ads1115_op_cost_t *cost);
+
+/**
+ * @brief Evaluates a device plan on one bus.
+ * @details Devices are assumed to be serviced round-robin; when their combined
+ * bus demand exceeds the bus, all rates are scaled down by the same factor.
+ * A blocking device keeps its calling thread busy for the whole sample time, so
+ * each blocking device is assumed to have a thread of its own. Latency counts
+ * one full round over the device's channels, the conversion and result read of
+ * the channel, and one sample's worth of bus traffic from every other device.
+ * @param bus Bus model.
+ * @param devices Plan entries (outputs are written in place).
+ * @param device_count Number of entries.
+ * @param[out] report Pointer to store the bus-wide figures (may be NULL).
+ * @return ADS1115_ERROR_INVALID_PARAM for a continuous device with more than one channel.
+ */
+ads1115_error_t ads1115_planner_evaluate(const ads1115_bus_model_t *bus, ads1115_plan_device_t *devices, uint8_t device_count,
+                                         ads1115_plan_report_t *report);
+
+/** @} */ // End of ADS1115_Planner
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADS1115_PLANNER_H */
@@ -0,0 +1,299 @@
+/**
+ * @file ads1115_scheduler.c
+ * @brief ADS1115 Multi-Rate Sampling Scheduler - Implementation File
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ */
+
+#include "ads1115_scheduler.h"
+#include "ads1115_planner.h"
+#include <stddef.h>
+
+/**
+ * @addtogroup ADS1115_Scheduler
+ * @{
+ */
+
+/*===========================================================================*/
+/* PRIVATE FUNCTIONS                                                         */
+/*===========================================================================*/
+
+/**
+ * @brief Relative deadline of a channel (period if not set).
+ */
+static uint32_t channel_deadline(const ads1115_sched_channel_t *ch)
+{
+    return ch->deadline_us ? ch->deadline_us : ch->period_us;
+}
+
+/**
+ * @brief Returns the device slot serving @p handle, adding it if necessary.
+ * @return Slot index or @ref ADS1115_SCHED_NO_CHANNEL if all slots are taken.
+ */
+static uint8_t device_slot(ads1115_scheduler_t *sched, ads1115_handle_t *handle)
+{
+    for (uint8_t i = 0; i < sched->device_count; i++)
+    {
+        if (sched->devices[i].handle == handle)
+            return i;
+    }
+    if (sched->device_count >= ADS1115_SCHED_MAX_DEVICES)
+        return ADS1115_SCHED_NO_CHANNEL;
+    sched->devices[sched->device_count].handle = handle;
+    sched->devices[sched->device_count].active = ADS1115_SCHED_NO_CHANNEL;
+    sched->devices[sched->device_count].done_us = 0;
+    return sched->device_count++;
+}
+
+/**
+ * @brief Picks the fastest data rate meeting the noise ceiling of a channel.
+ * @return true if a data rate was found.
+ */
+static bool select_data_rate(ads1115_sched_channel_t *ch)
+{
+    for (int rate = ADS1115_DR_860_SPS; rate >= ADS1115_DR_8_SPS; rate--)
+    {
+        float pp_uv;
+        if (ads1115_get_noise_uv(ch->range, (ads1115_data_rate_t)rate, NULL, &pp_uv) != ADS1115_OK)
+            return false;
+        if (ch->max_noise_uv <= 0.0f || pp_uv <= ch->max_noise_uv)
+        {
+            ch->data_rate = (ads1115_data_rate_t)rate;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Modeled bus time of one driver operation on the scheduled bus.
+ */
+static uint32_t op_bus_us(const ads1115_scheduler_t *sched, ads1115_op_t op)
+{
+    ads1115_bus_model_t bus = {sched->bus_clock_hz, sched->txn_overhead_us, false};
+    ads1115_op_cost_t cost;
+    ads1115_planner_op_cost(&bus, op, ADS1115_DR_128_SPS, &cost);
+    return cost.bus_us;
+}
+
+/*===========================================================================*/
+/* PUBLIC API IMPLEMENTATIONS                                                */
+/*===========================================================================*/
+
+ads1115_error_t ads1115_scheduler_init(ads1115_scheduler_t *sched, ads1115_sched_channel_t *channels, uint8_t channel_count,
+                                       uint32_t bus_clock_hz, ads1115_sched_sample_t on_sample, void *user_data)
+{
+    if (sched == NULL || channels == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (channel_count == 0 || channel_count >= ADS1115_SCHED_NO_CHANNEL || bus_clock_hz == 0)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    sched->channels = channels;
+    sched->channel_count = channel_count;
+    sched->bus_clock_hz = bus_clock_hz;
+    sched->txn_overhead_us = 0;
+    sched->on_sample = on_sample;
+    sched->user_data = user_data;
+    sched->device_count = 0;
+    sched->is_planned = false;
+    return ADS1115_OK;
+}
+
+uint32_t ads1115_scheduler_bus_time_us(const ads1115_scheduler_t *sched)
+{
+    return op_bus_us(sched, ADS1115_OP_SINGLE_START) + op_bus_us(sched, ADS1115_OP_READ_RESULT);
+}
+
+ads1115_error_t ads1115_scheduler_plan(ads1115_scheduler_t *sched, ads1115_sched_report_t *report)
+{
+    if (sched == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+
+    ads1115_sched_report_t local = {0};
+    local.feasible = true;
+    local.first_failing_channel = ADS1115_SCHED_NO_CHANNEL;
+
+    uint32_t bus_us = ads1115_scheduler_bus_time_us(sched);
+    sched->device_count = 0;
+    sched->is_planned = false;
+
+    for (uint8_t i = 0; i < sched->channel_count; i++)
+    {
+        ads1115_sched_channel_t *ch = &sched->channels[i];
+        if (ch->handle == NULL)
+            return ADS1115_ERROR_NULL_POINTER;
+        if (ch->mux > ADS1115_MUX_AIN3_GND || ch->range > ADS1115_RANGE_0V256 || ch->period_us == 0)
+            return ADS1115_ERROR_INVALID_PARAM;
+
+        uint8_t slot = device_slot(sched, ch->handle);
+        if (slot == ADS1115_SCHED_NO_CHANNEL)
+            return ADS1115_ERROR_INVALID_PARAM;
+
+        if (!select_data_rate(ch))
+        {
+            ch->data_rate = ADS1115_DR_8_SPS;
+            if (local.first_failing_channel == ADS1115_SCHED_NO_CHANNEL)
+                local.first_failing_channel = i;
+            local.feasible = false;
+        }
+        ads1115_get_conversion_time_max_us(ch->data_rate, &ch->cost_us);
+        ch->cost_us += bus_us;
+        ch->missed = 0;
+
+        uint32_t window = channel_deadline(ch) < ch->period_us ? channel_deadline(ch) : ch->period_us;
+        local.device_utilization[slot] += (float)ch->cost_us / (float)window;
+        local.bus_utilization += (float)bus_us / (float)window;
+    }
+
+    /* Non-preemptive blocking: a job may wait for the longest other job on its device */
+    for (uint8_t i = 0; i < sched->channel_count; i++)
+    {
+        const ads1115_sched_channel_t *ch = &sched->channels[i];
+        uint32_t blocking = 0;
+        for (uint8_t j = 0; j < sched->channel_count; j++)
+        {
+            const ads1115_sched_channel_t *other = &sched->channels[j];
+            if (j != i && other->handle == ch->handle && other->cost_us > blocking)
+                blocking = other->cost_us;
+        }
+        if (ch->cost_us + blocking > channel_deadline(ch))
+        {
+            local.feasible = false;
+            if (local.first_failing_channel == ADS1115_SCHED_NO_CHANNEL)
+                local.first_failing_channel = i;
+        }
+    }
+
+    for (uint8_t d = 0; d < sched->device_count; d++)
+    {
+        if (local.device_utilization[d] > 1.0f)
+            local.feasible = false;
+    }
+    if (local.bus_utilization > 1.0f)
+        local.feasible = false;
+
+    sched->is_planned = local.feasible;
+    if (report)
+        *report = local;
+    return local.feasible ? ADS1115_OK : ADS1115_ERROR_INVALID_PARAM;
+}
+
+ads1115_error_t ads1115_scheduler_start(ads1115_scheduler_t *sched, uint32_t now_us)
+{
+    if (sched == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (!sched->is_planned)
+        return ADS1115_ERROR_NOT_INITIALIZED;
+
+    for (uint8_t i = 0; i < sched->channel_count; i++)
+    {
+        ads1115_sched_channel_t *ch = &sched->channels[i];
+        ch->release_us = now_us;
+        ch->abs_deadline_us = now_us + channel_deadline(ch);
+        ch->missed = 0;
+    }
+    for (uint8_t d = 0; d < sched->device_count; d++)
+        sched->devices[d].active = ADS1115_SCHED_NO_CHANNEL;
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_scheduler_poll(ads1115_scheduler_t *sched, uint32_t now_us)
+{
+    if (sched == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (!sched->is_planned)
+        return ADS1115_ERROR_NOT_INITIALIZED;
+
+    /* Transactions run back to back from now_us; track when each one has finished */
+    uint32_t start_bus_us = op_bus_us(sched, ADS1115_OP_SINGLE_START);
+    uint32_t collect_bus_us = op_bus_us(sched, ADS1115_OP_READ_RESULT);
+    uint32_t bus_us = 0;
+
+    for (uint8_t d = 0; d < sched->device_count; d++)
+    {
+        ads1115_sched_device_t *dev = &sched->devices[d];
+
+        if (dev->active != ADS1115_SCHED_NO_CHANNEL)
+        {
+            if (!ads1115_time_reached(now_us, dev->done_us))
+                continue;
+
+            uint8_t index = dev->active;
+            ads1115_sched_channel_t *ch = &sched->channels[index];
+            int16_t raw;
+            float voltage;
+            dev->active = ADS1115_SCHED_NO_CHANNEL;
+            ads1115_error_t err = ads1115_single_collect(dev->handle, &raw, &voltage);
+            if (err != ADS1115_OK)
+                return err;
+            bus_us += collect_bus_us;
+
+            if (!ads1115_time_reached(ch->abs_deadline_us, now_us))
+                ch->missed++;
+            if (sched->on_sample)
+                sched->on_sample(index, raw, voltage, now_us, sched->user_data);
+
+            /* Drop jobs whose release has already been overtaken by the next one */
+            ch->release_us += ch->period_us;
+            while (ads1115_time_reached(now_us, ch->release_us + ch->period_us))
+            {
+                ch->release_us += ch->period_us;
+                ch->missed++;
+            }
+            ch->abs_deadline_us = ch->release_us + channel_deadline(ch);
+        }
+
+        uint8_t best = ADS1115_SCHED_NO_CHANNEL;
+        for (uint8_t i = 0; i < sched->channel_count; i++)
+        {
+            const ads1115_sched_channel_t *ch = &sched->channels[i];
+            if (ch->handle != dev->handle || !ads1115_time_reached(now_us, ch->release_us))
+                continue;
+            if (best == ADS1115_SCHED_NO_CHANNEL ||
+                (int32_t)(ch->abs_deadline_us - sched->channels[best].abs_deadline_us) < 0)
+                best = i;
+        }
+        if (best == ADS1115_SCHED_NO_CHANNEL)
+            continue;
+
+        ads1115_sched_channel_t *next = &sched->channels[best];
+        dev->handle->config.mux = next->mux;
+        dev->handle->config.range = next->range;
+        dev->handle->config.data_rate = next->data_rate;
+        dev->handle->config.mode = ADS1115_MODE_SINGLE_SHOT;
+        ads1115_error_t err = ads1115_single_start(dev->handle);
+        if (err != ADS1115_OK)
+            return err;
+        bus_us += start_bus_us;
+        dev->active = best;
+        ads1115_get_conversion_time_max_us(next->data_rate, &dev->done_us);
+        dev->done_us += now_us + bus_us;
+    }
+    return ADS1115_OK;
+}
+
+uint32_t ads1115_scheduler_next_event_us(const ads1115_scheduler_t *sched, uint32_t now_us)
+{
+    uint32_t next = now_us + 0x7FFFFFFFU;
+
+    for (uint8_t d = 0; d < sched->device_count; d++)
+    {
+        const ads1115_sched_device_t *dev = &sched->devices[d];
+        if (dev->active != ADS1115_SCHED_NO_CHANNEL)
+        {
+            if ((int32_t)(dev->done_us - next) < 0)
+                next = dev->done_us;
+            continue;
+        }
+        for (uint8_t i = 0; i < sched->channel_count; i++)
+        {
+            const ads1115_sched_channel_t *ch = &sched->channels[i];
+            if (ch->handle == dev->handle && (int32_t)(ch->release_us - next) < 0)
+                next = ch->release_us;
+        }
+    }
+    return ads1115_time_reached(now_us, next) ? now_us : next;
+}
+
+/** @} */ // End of ADS1115_Scheduler
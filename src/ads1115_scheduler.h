@@ -0,0 +1,177 @@
+/**
+ * @file ads1115_scheduler.h
+ * @brief ADS1115 Multi-Rate Sampling Scheduler - Header File
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ *
+ * @details Plans single-shot conversions for many (device, MUX) channels sharing
+ * one I2C bus using earliest-deadline-first ordering. Each channel declares a
+ * sampling period, a relative deadline and a noise ceiling; the scheduler picks
+ * the fastest data rate that still satisfies the noise ceiling and checks whether
+ * the whole set is feasible given the modeled bus time and conversion times.
+ */
+
+#ifndef ADS1115_SCHEDULER_H
+#define ADS1115_SCHEDULER_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include "ads1115.h"
+
+/**
+ * @defgroup ADS1115_Scheduler Sampling Scheduler
+ * @ingroup ADS1115_Driver
+ * @brief Deadline-driven multi-rate sampling across channels and devices.
+ * @{
+ */
+
+/** @brief Maximum number of devices on one scheduled bus (one per ADDR pin option). */
+#ifndef ADS1115_SCHED_MAX_DEVICES
+#define ADS1115_SCHED_MAX_DEVICES 4
+#endif
+
+/** @brief Marker for "no channel" in device slots and reports. */
+#define ADS1115_SCHED_NO_CHANNEL 0xFF
+
+/**
+ * @brief Per-channel sampling request and runtime state.
+ * @details The first block is filled by the application; the remaining fields are
+ * owned by the scheduler and must not be modified while it is running.
+ */
+typedef struct
+{
+    ads1115_handle_t *handle;      /**< Device this channel lives on */
+    ads1115_mux_t mux;             /**< Input multiplexer selection */
+    ads1115_range_t range;         /**< Full-scale range for this channel */
+    uint32_t period_us;            /**< Sampling period in microseconds */
+    uint32_t deadline_us;          /**< Relative deadline, 0 means equal to the period */
+    float max_noise_uv;            /**< Peak-to-peak noise ceiling in microvolts, 0 means none */
+
+    ads1115_data_rate_t data_rate; /**< Data rate selected by @ref ads1115_scheduler_plan */
+    uint32_t cost_us;              /**< Worst-case device time per sample (bus + conversion) */
+    uint32_t release_us;           /**< Release time of the pending job */
+    uint32_t abs_deadline_us;      /**< Absolute deadline of the pending job */
+    uint32_t missed;               /**< Number of samples that completed late or were skipped */
+} ads1115_sched_channel_t;
+
+/**
+ * @brief Callback invoked for every completed sample.
+ * @param channel_index Index into the channel table.
+ * @param adc_raw Raw conversion result.
+ * @param voltage Converted voltage, scaled like @ref ads1115_single_read.
+ * @param timestamp_us Time at which the result was collected.
+ * @param user_data Opaque pointer given to the scheduler.
+ */
+typedef void (*ads1115_sched_sample_t)(uint8_t channel_index, int16_t adc_raw, float voltage, uint32_t timestamp_us, void *user_data);
+
+/**
+ * @brief Feasibility report produced by @ref ads1115_scheduler_plan.
+ */
+typedef struct
+{
+    bool feasible;                                  /**< True if every deadline can be met */
+    float bus_utilization;                          /**< Bus density (sum of bus time / min(D, T)) */
+    float device_utilization[ADS1115_SCHED_MAX_DEVICES]; /**< Device density per device slot */
+    uint8_t first_failing_channel;                  /**< First channel that cannot be served, or @ref ADS1115_SCHED_NO_CHANNEL */
+} ads1115_sched_report_t;
+
+/**
+ * @brief Per-device in-flight conversion state.
+ */
+typedef struct
+{
+    ads1115_handle_t *handle; /**< Device handle */
+    uint8_t active;           /**< Channel currently converting, or @ref ADS1115_SCHED_NO_CHANNEL */
+    uint32_t done_us;         /**< End of the modeled start write plus the worst-case conversion time */
+} ads1115_sched_device_t;
+
+/**
+ * @brief Scheduler instance for one I2C bus.
+ */
+typedef struct
+{
+    ads1115_sched_channel_t *channels;                     /**< Application-owned channel table */
+    uint8_t channel_count;                                 /**< Number of entries in the table */
+    uint32_t bus_clock_hz;                                 /**< I2C SCL frequency used by the bus model */
+    uint32_t txn_overhead_us;                              /**< Fixed software/driver overhead per transaction */
+    ads1115_sched_sample_t on_sample;                      /**< Sample delivery callback */
+    void *user_data;                                       /**< Passed to @ref on_sample */
+    ads1115_sched_device_t devices[ADS1115_SCHED_MAX_DEVICES]; /**< Devices discovered from the channel table */
+    uint8_t device_count;                                  /**< Number of used device slots */
+    bool is_planned;                                       /**< Set once a feasible plan exists */
+} ads1115_scheduler_t;
+
+/**
+ * @brief Initializes the scheduler with a channel table.
+ * @param sched Pointer to the scheduler instance.
+ * @param channels Channel table (kept by reference).
+ * @param channel_count Number of channels (less than @ref ADS1115_SCHED_NO_CHANNEL).
+ * @param bus_clock_hz I2C clock frequency, e.g. 400000.
+ * @param on_sample Callback for completed samples (may be NULL).
+ * @param user_data Opaque pointer handed to the callback.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_scheduler_init(ads1115_scheduler_t *sched, ads1115_sched_channel_t *channels, uint8_t channel_count,
+                                       uint32_t bus_clock_hz, ads1115_sched_sample_t on_sample, void *user_data);
+
+/**
+ * @brief Modeled bus time of one scheduled sample (start + collect transactions).
+ * @param sched Pointer to the scheduler instance.
+ * @return Bus time in microseconds, rounded up.
+ */
+uint32_t ads1115_scheduler_bus_time_us(const ads1115_scheduler_t *sched);
+
+/**
+ * @brief Selects data rates and checks feasibility of the channel set.
+ * @details For every channel the fastest data rate whose datasheet peak-to-peak
+ * noise at the channel range is within @ref ads1115_sched_channel_t::max_noise_uv
+ * is selected. Feasibility uses a non-preemptive EDF density test per device
+ * (conversions on one device are serial and cannot be interrupted) and on the bus,
+ * with conversion times derated by the @f$\pm 10\%@f$ oscillator tolerance.
+ * The scheduler only runs once a plan is feasible; @ref ads1115_scheduler_start
+ * and @ref ads1115_scheduler_poll return ADS1115_ERROR_NOT_INITIALIZED otherwise.
+ * @param sched Pointer to the scheduler instance.
+ * @param[out] report Pointer to store the feasibility report (may be NULL).
+ * @return ADS1115_OK if feasible, ADS1115_ERROR_INVALID_PARAM otherwise.
+ */
+ads1115_error_t ads1115_scheduler_plan(ads1115_scheduler_t *sched, ads1115_sched_report_t *report);
+
+/**
+ * @brief Releases the first job of every channel at @p now_us.
+ * @param sched Pointer to the scheduler instance.
+ * @param now_us Current time in microseconds.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_scheduler_start(ads1115_scheduler_t *sched, uint32_t now_us);
+
+/**
+ * @brief Services the scheduler; never blocks.
+ * @details Collects every conversion that is due, then starts the released job with
+ * the earliest absolute deadline on each idle device. Call it whenever the time
+ * returned by @ref ads1115_scheduler_next_event_us is reached.
+ * Transactions are modeled as running back to back from @p now_us, so a
+ * conversion is due its worst-case time after the modeled end of its start write.
+ * @param sched Pointer to the scheduler instance.
+ * @param now_us Current time in microseconds (wrap-around safe).
+ * @return @ref ads1115_error_t result of the first failing bus operation.
+ */
+ads1115_error_t ads1115_scheduler_poll(ads1115_scheduler_t *sched, uint32_t now_us);
+
+/**
+ * @brief Returns the next time at which @ref ads1115_scheduler_poll has work to do.
+ * @param sched Pointer to the scheduler instance.
+ * @param now_us Current time in microseconds.
+ * @return Absolute time in microseconds (equal to @p now_us if work is pending).
+ */
+uint32_t ads1115_scheduler_next_event_us(const ads1115_scheduler_t *sched, uint32_t now_us);
+
+/** @} */ // End of ADS1115_Scheduler
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADS1115_SCHEDULER_H */
@@ -0,0 +1,282 @@
+/**
+ * @file ads1115_stats.c
+ * @brief ADS1115 Block Statistics on Raw Conversion Codes - Implementation File
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ */
+
+#include "ads1115_stats.h"
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define STATS_USE_SSE2 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define STATS_USE_NEON 1
+#endif
+
+/**
+ * @addtogroup ADS1115_Stats
+ * @{
+ */
+
+/*===========================================================================*/
+/* PRIVATE CONSTANTS                                                         */
+/*===========================================================================*/
+
+#if ADS1115_STATS_BINS < 1 || ADS1115_STATS_BINS > 32768
+#error "ADS1115_STATS_BINS must be between 1 and 32768"
+#endif
+
+/** @brief Vector iterations between flushes of the 32-bit sum lanes (no overflow possible) */
+#define STATS_FLUSH_ITERATIONS 16384U
+
+/*===========================================================================*/
+/* PRIVATE FUNCTIONS                                                         */
+/*===========================================================================*/
+
+/**
+ * @brief Histogram bin of a code, clamped to the edge bins.
+ */
+static uint32_t bin_index(const ads1115_stats_t *stats, int16_t raw)
+{
+    int32_t offset = (int32_t)raw - (int32_t)stats->hist_low;
+    if (offset < 0)
+        return 0;
+    uint32_t bin = (uint32_t)offset >> stats->hist_shift;
+    return bin < ADS1115_STATS_BINS ? bin : ADS1115_STATS_BINS - 1U;
+}
+
+/**
+ * @brief Scalar accumulation, also used for the tail of the vector paths.
+ */
+static void update_scalar(ads1115_stats_t *stats, const int16_t *samples, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        int16_t v = samples[i];
+        if (v < stats->min)
+            stats->min = v;
+        if (v > stats->max)
+            stats->max = v;
+        stats->sum += v;
+        stats->sum_sq += (uint64_t)((int32_t)v * (int32_t)v);
+        stats->histogram[bin_index(stats, v)]++;
+    }
+}
+
+#if defined(STATS_USE_SSE2)
+/**
+ * @brief SSE2 accumulation of whole 8-sample vectors; returns the samples consumed.
+ */
+static uint32_t update_vector(ads1115_stats_t *stats, const int16_t *samples, uint32_t count)
+{
+    uint32_t vectors = count / 8U;
+    __m128i vmin = _mm_set1_epi16(stats->min);
+    __m128i vmax = _mm_set1_epi16(stats->max);
+    __m128i ones = _mm_set1_epi16(1);
+    __m128i zero = _mm_setzero_si128();
+    __m128i sq64 = _mm_setzero_si128();
+    /* Bins on the offset-binary code: saturating subtract clamps below, unsigned min clamps above */
+    __m128i bias = _mm_set1_epi16((int16_t)0x8000);
+    __m128i low = _mm_set1_epi16((int16_t)((uint16_t)stats->hist_low ^ 0x8000U));
+    __m128i last_bin = _mm_set1_epi16((int16_t)(ADS1115_STATS_BINS - 1U));
+    __m128i shift = _mm_cvtsi32_si128(stats->hist_shift);
+    uint16_t bins[8];
+
+    for (uint32_t done = 0; done < vectors;)
+    {
+        uint32_t batch = vectors - done < STATS_FLUSH_ITERATIONS ? vectors - done : STATS_FLUSH_ITERATIONS;
+        __m128i sum32 = _mm_setzero_si128();
+        for (uint32_t i = 0; i < batch; i++, done++)
+        {
+            const int16_t *p = &samples[done * 8U];
+            __m128i v = _mm_loadu_si128((const __m128i *)(const void *)p);
+            vmin = _mm_min_epi16(vmin, v);
+            vmax = _mm_max_epi16(vmax, v);
+            sum32 = _mm_add_epi32(sum32, _mm_madd_epi16(v, ones));
+            /* Pair sums of squares reach 2^31 at most, so they are exact as unsigned 32-bit */
+            __m128i sq = _mm_madd_epi16(v, v);
+            sq64 = _mm_add_epi64(sq64, _mm_unpacklo_epi32(sq, zero));
+            sq64 = _mm_add_epi64(sq64, _mm_unpackhi_epi32(sq, zero));
+            __m128i bin = _mm_srl_epi16(_mm_subs_epu16(_mm_xor_si128(v, bias), low), shift);
+            bin = _mm_sub_epi16(bin, _mm_subs_epu16(bin, last_bin));
+            _mm_storeu_si128((__m128i *)(void *)bins, bin);
+            for (uint32_t k = 0; k < 8U; k++)
+                stats->histogram[bins[k]]++;
+        }
+        int32_t lanes[4];
+        _mm_storeu_si128((__m128i *)(void *)lanes, sum32);
+        stats->sum += (int64_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    }
+
+    int16_t mins[8], maxs[8];
+    uint64_t sqs[2];
+    _mm_storeu_si128((__m128i *)(void *)mins, vmin);
+    _mm_storeu_si128((__m128i *)(void *)maxs, vmax);
+    _mm_storeu_si128((__m128i *)(void *)sqs, sq64);
+    for (uint32_t k = 0; k < 8U; k++)
+    {
+        if (mins[k] < stats->min)
+            stats->min = mins[k];
+        if (maxs[k] > stats->max)
+            stats->max = maxs[k];
+    }
+    stats->sum_sq += sqs[0] + sqs[1];
+    return vectors * 8U;
+}
+#elif defined(STATS_USE_NEON)
+/**
+ * @brief NEON accumulation of whole 8-sample vectors; returns the samples consumed.
+ */
+static uint32_t update_vector(ads1115_stats_t *stats, const int16_t *samples, uint32_t count)
+{
+    uint32_t vectors = count / 8U;
+    int16x8_t vmin = vdupq_n_s16(stats->min);
+    int16x8_t vmax = vdupq_n_s16(stats->max);
+    uint64x2_t sq64 = vdupq_n_u64(0);
+    /* Bins on the offset-binary code: saturating subtract clamps below, unsigned min clamps above */
+    uint16x8_t bias = vdupq_n_u16(0x8000U);
+    uint16x8_t low = vdupq_n_u16((uint16_t)((uint16_t)stats->hist_low ^ 0x8000U));
+    uint16x8_t last_bin = vdupq_n_u16((uint16_t)(ADS1115_STATS_BINS - 1U));
+    int16x8_t shift = vdupq_n_s16((int16_t)-(int16_t)stats->hist_shift);
+    uint16_t bins[8];
+
+    for (uint32_t done = 0; done < vectors;)
+    {
+        uint32_t batch = vectors - done < STATS_FLUSH_ITERATIONS ? vectors - done : STATS_FLUSH_ITERATIONS;
+        int32x4_t sum32 = vdupq_n_s32(0);
+        for (uint32_t i = 0; i < batch; i++, done++)
+        {
+            const int16_t *p = &samples[done * 8U];
+            int16x8_t v = vld1q_s16(p);
+            vmin = vminq_s16(vmin, v);
+            vmax = vmaxq_s16(vmax, v);
+            sum32 = vpadalq_s16(sum32, v);
+            int32x4_t sq_lo = vmull_s16(vget_low_s16(v), vget_low_s16(v));
+            int32x4_t sq_hi = vmull_s16(vget_high_s16(v), vget_high_s16(v));
+            sq64 = vpadalq_u32(sq64, vreinterpretq_u32_s32(sq_lo));
+            sq64 = vpadalq_u32(sq64, vreinterpretq_u32_s32(sq_hi));
+            uint16x8_t bin = vshlq_u16(vqsubq_u16(veorq_u16(vreinterpretq_u16_s16(v), bias), low), shift);
+            vst1q_u16(bins, vminq_u16(bin, last_bin));
+            for (uint32_t k = 0; k < 8U; k++)
+                stats->histogram[bins[k]]++;
+        }
+        int64x2_t wide = vpaddlq_s32(sum32);
+        stats->sum += vgetq_lane_s64(wide, 0) + vgetq_lane_s64(wide, 1);
+    }
+
+    int16_t mins[8], maxs[8];
+    vst1q_s16(mins, vmin);
+    vst1q_s16(maxs, vmax);
+    for (uint32_t k = 0; k < 8U; k++)
+    {
+        if (mins[k] < stats->min)
+            stats->min = mins[k];
+        if (maxs[k] > stats->max)
+            stats->max = maxs[k];
+    }
+    stats->sum_sq += vgetq_lane_u64(sq64, 0) + vgetq_lane_u64(sq64, 1);
+    return vectors * 8U;
+}
+#else
+static uint32_t update_vector(ads1115_stats_t *stats, const int16_t *samples, uint32_t count)
+{
+    (void)stats;
+    (void)samples;
+    (void)count;
+    return 0;
+}
+#endif
+
+/*===========================================================================*/
+/* PUBLIC API IMPLEMENTATIONS                                                */
+/*===========================================================================*/
+
+ads1115_error_t ads1115_stats_init(ads1115_stats_t *stats, int16_t hist_low, uint8_t hist_shift)
+{
+    if (stats == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (hist_shift > 16U)
+        return ADS1115_ERROR_INVALID_PARAM;
+    stats->hist_low = hist_low;
+    stats->hist_shift = hist_shift;
+    return ads1115_stats_reset(stats);
+}
+
+ads1115_error_t ads1115_stats_reset(ads1115_stats_t *stats)
+{
+    if (stats == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    stats->count = 0;
+    stats->min = INT16_MAX;
+    stats->max = INT16_MIN;
+    stats->sum = 0;
+    stats->sum_sq = 0;
+    memset(stats->histogram, 0, sizeof(stats->histogram));
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_stats_update(ads1115_stats_t *stats, const int16_t *samples, uint32_t count)
+{
+    if (stats == NULL || (samples == NULL && count > 0U))
+        return ADS1115_ERROR_NULL_POINTER;
+
+    uint32_t done = update_vector(stats, samples, count);
+    update_scalar(stats, samples + done, count - done);
+    stats->count += count;
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_stats_merge(ads1115_stats_t *dst, const ads1115_stats_t *src)
+{
+    if (dst == NULL || src == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (dst->hist_low != src->hist_low || dst->hist_shift != src->hist_shift)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    if (src->min < dst->min)
+        dst->min = src->min;
+    if (src->max > dst->max)
+        dst->max = src->max;
+    dst->count += src->count;
+    dst->sum += src->sum;
+    dst->sum_sq += src->sum_sq;
+    for (uint32_t i = 0; i < ADS1115_STATS_BINS; i++)
+        dst->histogram[i] += src->histogram[i];
+    return ADS1115_OK;
+}
+
+ads1115_error_t ads1115_stats_finalize(const ads1115_stats_t *stats, const ads1115_config_t *config, ads1115_stats_result_t *result)
+{
+    if (stats == NULL || config == NULL || result == NULL)
+        return ADS1115_ERROR_NULL_POINTER;
+    if (stats->count == 0U)
+        return ADS1115_ERROR_INVALID_PARAM;
+
+    float lsb;
+    ads1115_error_t err = ads1115_raw_to_voltage(config->range, 1, &lsb);
+    if (err != ADS1115_OK)
+        return err;
+
+    double n = (double)stats->count;
+    double mean = (double)stats->sum / n;
+    double mean_sq = (double)stats->sum_sq / n;
+    double variance = mean_sq - mean * mean;
+
+    result->count = stats->count;
+    result->min_raw = stats->min;
+    result->max_raw = stats->max;
+    ads1115_raw_to_voltage(config->range, stats->min, &result->min);
+    ads1115_raw_to_voltage(config->range, stats->max, &result->max);
+    result->mean = (float)(mean * lsb);
+    result->rms = (float)(sqrt(mean_sq) * lsb);
+    result->stddev = (float)(sqrt(variance > 0.0 ? variance : 0.0) * lsb);
+    return ADS1115_OK;
+}
+
+/** @} */ // End of ADS1115_Stats
@@ -0,0 +1,117 @@
+/**
+ * @file ads1115_stats.h
+ * @brief ADS1115 Block Statistics on Raw Conversion Codes - Header File
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ *
+ * @details Computes min, max, sum, sum of squares and a fixed-bin histogram of
+ * raw int16_t conversion codes in a single pass with integer accumulators, using
+ * SSE2 or NEON when the compiler targets them. Accumulators can be updated block
+ * by block on streaming data; values are scaled like @ref ads1115_single_read
+ * (millivolts) only when the final figures are requested, using the range of an
+ * @ref ads1115_config_t.
+ */
+
+#ifndef ADS1115_STATS_H
+#define ADS1115_STATS_H
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#include "ads1115.h"
+
+/**
+ * @defgroup ADS1115_Stats Block Statistics
+ * @ingroup ADS1115_Driver
+ * @brief Single-pass summary statistics over raw sample buffers.
+ * @{
+ */
+
+/** @brief Number of histogram bins. */
+#ifndef ADS1115_STATS_BINS
+#define ADS1115_STATS_BINS 16
+#endif
+
+/**
+ * @brief Integer accumulators; valid across any number of updates.
+ */
+typedef struct
+{
+    uint64_t count;                           /**< Samples accumulated */
+    int16_t min;                              /**< Smallest code */
+    int16_t max;                              /**< Largest code */
+    int64_t sum;                              /**< Sum of codes */
+    uint64_t sum_sq;                          /**< Sum of squared codes */
+    int16_t hist_low;                         /**< Lower edge of bin 0 */
+    uint8_t hist_shift;                       /**< Bin width is 2^hist_shift codes */
+    uint32_t histogram[ADS1115_STATS_BINS];   /**< Bin counts; out-of-range codes go to the edge bins */
+} ads1115_stats_t;
+
+/**
+ * @brief Final figures of an accumulator.
+ */
+typedef struct
+{
+    uint64_t count;  /**< Samples accumulated */
+    int16_t min_raw; /**< Smallest code */
+    int16_t max_raw; /**< Largest code */
+    float min;       /**< Smallest value, scaled like @ref ads1115_single_read */
+    float max;       /**< Largest value */
+    float mean;      /**< Mean value */
+    float rms;       /**< Root mean square */
+    float stddev;    /**< Population standard deviation */
+} ads1115_stats_result_t;
+
+/**
+ * @brief Initializes an accumulator and its histogram layout.
+ * @details Passing hist_low = INT16_MIN and hist_shift = 16 - log2(@ref ADS1115_STATS_BINS)
+ * spreads the bins over the whole code range.
+ * @param stats Pointer to the accumulator.
+ * @param hist_low Lower edge of the first bin.
+ * @param hist_shift log2 of the bin width in codes (0..16).
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_stats_init(ads1115_stats_t *stats, int16_t hist_low, uint8_t hist_shift);
+
+/**
+ * @brief Clears the accumulators, keeping the histogram layout.
+ * @param stats Pointer to the accumulator.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_stats_reset(ads1115_stats_t *stats);
+
+/**
+ * @brief Accumulates a block of raw codes.
+ * @param stats Pointer to the accumulator.
+ * @param samples Raw conversion results.
+ * @param count Number of samples.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_stats_update(ads1115_stats_t *stats, const int16_t *samples, uint32_t count);
+
+/**
+ * @brief Adds the accumulators of @p src to @p dst (identical histogram layout required).
+ * @param dst Destination accumulator.
+ * @param src Source accumulator.
+ * @return @ref ads1115_error_t result.
+ */
+ads1115_error_t ads1115_stats_merge(ads1115_stats_t *dst, const ads1115_stats_t *src);
+
+/**
+ * @brief Converts the accumulators into final figures.
+ * @param stats Pointer to the accumulator.
+ * @param config Configuration whose range the codes were converted with.
+ * @param[out] result Pointer to store the figures.
+ * @return ADS1115_ERROR_INVALID_PARAM if no samples were accumulated.
+ */
+ads1115_error_t ads1115_stats_finalize(const ads1115_stats_t *stats, const ads1115_config_t *config, ads1115_stats_result_t *result);
+
+/** @} */ // End of ADS1115_Stats
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADS1115_STATS_H */
@@ -0,0 +1,269 @@
+/**
+ * @file ads1115_iio_test.c
+ * @brief ADS1115 Linux IIO Backend - Fake sysfs Test
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ *
+ * @details Builds a fake IIO tree in a temporary directory, laid out like the
+ * mainline ti-ads1015 driver exposes it (device name "ads1015" for both chips), and
+ * runs the backend against it: device discovery, direct-mode reads, scale writes,
+ * scan element layout and decoding of buffer records from a regular file standing
+ * in for the character device. The exit status is non-zero if any check fails.
+ *
+ * Build: cc -std=c11 -Isrc -Iinterface tests/ads1115_iio_test.c interface/ads1115_iio.c src/ads1115.c -o ads1115_iio_test
+ */
+
+#define _XOPEN_SOURCE 700
+
+#include "ads1115_iio.h"
+#include <ftw.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+/*===========================================================================*/
+/* PRIVATE CONSTANTS                                                         */
+/*===========================================================================*/
+
+/** @brief Channel names as created by ti-ads1015, indexed by @ref ads1115_mux_t */
+static const char *const CHANNELS[ADS1115_IIO_CHANNELS] = {
+    "voltage0-voltage1", "voltage0-voltage3", "voltage1-voltage3", "voltage2-voltage3",
+    "voltage0", "voltage1", "voltage2", "voltage3"};
+
+/** @brief Raw codes of the records written to the fake character device */
+static const int16_t RECORD_RAW[] = {12345, -32768, -1};
+
+#define RECORD_COUNT (sizeof(RECORD_RAW) / sizeof(RECORD_RAW[0]))
+
+/*===========================================================================*/
+/* PRIVATE FUNCTIONS                                                         */
+/*===========================================================================*/
+
+static char root[64];
+static unsigned failures;
+
+#define CHECK(cond)                                                   \
+    do                                                                \
+    {                                                                 \
+        if (!(cond))                                                  \
+        {                                                             \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond);    \
+            failures++;                                               \
+        }                                                             \
+    } while (0)
+
+static void path_of(char *path, size_t size, const char *rel)
+{
+    snprintf(path, size, "%s/%s", root, rel);
+}
+
+static void make_dir(const char *rel)
+{
+    char path[512];
+    path_of(path, sizeof(path), rel);
+    mkdir(path, 0755);
+}
+
+static void put(const char *rel, const char *value)
+{
+    char path[512];
+    path_of(path, sizeof(path), rel);
+    FILE *f = fopen(path, "w");
+    if (f == NULL)
+    {
+        printf("FAIL cannot create %s\n", path);
+        exit(1);
+    }
+    fputs(value, f);
+    fclose(f);
+}
+
+static const char *get(const char *rel)
+{
+    static char value[64];
+    char path[512];
+    path_of(path, sizeof(path), rel);
+    value[0] = '\0';
+    FILE *f = fopen(path, "r");
+    if (f == NULL)
+        return value;
+    if (fgets(value, sizeof(value), f) != NULL)
+        value[strcspn(value, "\n")] = '\0';
+    fclose(f);
+    return value;
+}
+
+/**
+ * @brief Creates one ti-ads1015 device directory with the given element type.
+ */
+static void make_device(const char *dev, const char *element_type)
+{
+    char rel[256];
+    make_dir(dev);
+    snprintf(rel, sizeof(rel), "%s/scan_elements", dev);
+    make_dir(rel);
+    snprintf(rel, sizeof(rel), "%s/buffer", dev);
+    make_dir(rel);
+    snprintf(rel, sizeof(rel), "%s/trigger", dev);
+    make_dir(rel);
+
+    snprintf(rel, sizeof(rel), "%s/name", dev);
+    put(rel, "ads1015\n");
+    for (int ch = 0; ch < ADS1115_IIO_CHANNELS; ch++)
+    {
+        char value[16];
+        snprintf(rel, sizeof(rel), "%s/in_%s_scale", dev, CHANNELS[ch]);
+        put(rel, "0.125000000\n");
+        snprintf(rel, sizeof(rel), "%s/in_%s_sampling_frequency", dev, CHANNELS[ch]);
+        put(rel, "475\n");
+        snprintf(rel, sizeof(rel), "%s/in_%s_raw", dev, CHANNELS[ch]);
+        snprintf(value, sizeof(value), "%d\n", -1000 * ch);
+        put(rel, value);
+        snprintf(rel, sizeof(rel), "%s/scan_elements/in_%s_en", dev, CHANNELS[ch]);
+        put(rel, "0\n");
+        snprintf(rel, sizeof(rel), "%s/scan_elements/in_%s_type", dev, CHANNELS[ch]);
+        put(rel, element_type);
+        snprintf(rel, sizeof(rel), "%s/scan_elements/in_%s_index", dev, CHANNELS[ch]);
+        snprintf(value, sizeof(value), "%d\n", ch);
+        put(rel, value);
+    }
+    snprintf(rel, sizeof(rel), "%s/scan_elements/in_timestamp_en", dev);
+    put(rel, "0\n");
+    snprintf(rel, sizeof(rel), "%s/scan_elements/in_timestamp_type", dev);
+    put(rel, "le:s64/64>>0\n");
+    snprintf(rel, sizeof(rel), "%s/scan_elements/in_timestamp_index", dev);
+    put(rel, "8\n");
+    snprintf(rel, sizeof(rel), "%s/buffer/length", dev);
+    put(rel, "2\n");
+    snprintf(rel, sizeof(rel), "%s/buffer/enable", dev);
+    put(rel, "0\n");
+    snprintf(rel, sizeof(rel), "%s/trigger/current_trigger", dev);
+    put(rel, "\n");
+}
+
+/**
+ * @brief Writes records of one s16 element plus timestamp (2 + 6 padding + 8 bytes).
+ */
+static void make_char_device(const char *rel)
+{
+    char path[512];
+    path_of(path, sizeof(path), rel);
+    FILE *f = fopen(path, "wb");
+    if (f == NULL)
+        exit(1);
+    for (unsigned r = 0; r < RECORD_COUNT; r++)
+    {
+        uint8_t record[16] = {0};
+        uint16_t raw = (uint16_t)RECORD_RAW[r];
+        uint64_t ts = 1000000000ULL + r * 2105263ULL;
+        record[0] = (uint8_t)raw;
+        record[1] = (uint8_t)(raw >> 8);
+        for (int i = 0; i < 8; i++)
+            record[8 + i] = (uint8_t)(ts >> (8 * i));
+        fwrite(record, sizeof(record), 1, f);
+    }
+    fclose(f);
+}
+
+static int remove_entry(const char *path, const struct stat *st, int flag, struct FTW *ftw)
+{
+    (void)st;
+    (void)flag;
+    (void)ftw;
+    return remove(path);
+}
+
+/*===========================================================================*/
+/* TEST                                                                      */
+/*===========================================================================*/
+
+int main(void)
+{
+    strcpy(root, "/tmp/ads1115_iio_XXXXXX");
+    if (mkdtemp(root) == NULL)
+    {
+        perror("mkdtemp");
+        return 1;
+    }
+    make_dir("sys");
+    make_dir("dev");
+    make_device("sys/iio:device0", "le:s12/16>>4\n"); /* ADS1015 */
+    make_device("sys/iio:device1", "le:s16/16>>0\n"); /* ADS1115 */
+    make_char_device("dev/iio:device1");
+
+    char sysfs_root[128], dev_root[128], dev0[160], dev1[160];
+    snprintf(sysfs_root, sizeof(sysfs_root), "%s/sys", root);
+    snprintf(dev_root, sizeof(dev_root), "%s/dev", root);
+    snprintf(dev0, sizeof(dev0), "%s/iio:device0", sysfs_root);
+    snprintf(dev1, sizeof(dev1), "%s/iio:device1", sysfs_root);
+
+    /* Binding: the 12-bit part is refused, the 16-bit one is found */
+    ads1115_iio_t iio;
+    CHECK(ads1115_iio_init(&iio, dev0, "/dev/null") == ADS1115_ERROR_INVALID_PARAM);
+    CHECK(ads1115_iio_find(&iio, sysfs_root, dev_root) == ADS1115_OK);
+    CHECK(strcmp(iio.sysfs_dir, dev1) == 0);
+    CHECK(iio.range[ADS1115_MUX_AIN0_GND] == ADS1115_RANGE_4V096);
+    CHECK(iio.data_rate[ADS1115_MUX_AIN0_GND] == ADS1115_DR_475_SPS);
+
+    /* Direct mode */
+    int16_t raw = 0;
+    float voltage = 0.0f;
+    CHECK(ads1115_iio_single_read(&iio, ADS1115_MUX_AIN2_GND, &raw, &voltage) == ADS1115_OK);
+    CHECK(raw == -6000);
+    CHECK(voltage > -750.01f && voltage < -749.99f);
+
+    /* Scale strings must map to the kernel full-scale table */
+    CHECK(ads1115_iio_set_range(&iio, ADS1115_MUX_AIN0_GND, ADS1115_RANGE_0V256) == ADS1115_OK);
+    CHECK(strcmp(get("sys/iio:device1/in_voltage0_scale"), "0.007813") == 0);
+    CHECK(ads1115_iio_set_data_rate(&iio, ADS1115_MUX_AIN0_GND, ADS1115_DR_860_SPS) == ADS1115_OK);
+    CHECK(strcmp(get("sys/iio:device1/in_voltage0_sampling_frequency"), "860") == 0);
+
+    /* Scan layout: one channel only, previous selection disabled */
+    put("sys/iio:device1/scan_elements/in_voltage3_en", "1\n");
+    CHECK(ads1115_iio_set_scan_channels(&iio, ADS1115_IIO_SCAN_BIT(ADS1115_MUX_AIN0_GND) | ADS1115_IIO_SCAN_BIT(ADS1115_MUX_AIN1_GND),
+                                        true) == ADS1115_ERROR_INVALID_PARAM);
+    CHECK(ads1115_iio_set_scan_channels(&iio, ADS1115_IIO_SCAN_BIT(ADS1115_MUX_AIN0_GND), true) == ADS1115_OK);
+    CHECK(strcmp(get("sys/iio:device1/scan_elements/in_voltage0_en"), "1") == 0);
+    CHECK(strcmp(get("sys/iio:device1/scan_elements/in_voltage3_en"), "0") == 0);
+    CHECK(strcmp(get("sys/iio:device1/scan_elements/in_timestamp_en"), "1") == 0);
+    CHECK(iio.record_bytes == 16U);
+    CHECK(iio.elements[ADS1115_MUX_AIN0_GND].offset == 0U);
+    CHECK(iio.ts_element.offset == 8U);
+
+    /* Buffered capture */
+    CHECK(ads1115_iio_buffer_start(&iio, 64, "ads1115-trig") == ADS1115_OK);
+    CHECK(strcmp(get("sys/iio:device1/buffer/length"), "64") == 0);
+    CHECK(strcmp(get("sys/iio:device1/trigger/current_trigger"), "ads1115-trig") == 0);
+    CHECK(strcmp(get("sys/iio:device1/buffer/enable"), "1") == 0);
+    CHECK(ads1115_iio_single_read(&iio, ADS1115_MUX_AIN0_GND, &raw, &voltage) == ADS1115_ERROR_CONVERSION_BUSY);
+
+    ads1115_iio_scan_t scans[RECORD_COUNT];
+    uint32_t total = 0, count = 0;
+    CHECK(ads1115_iio_buffer_read(&iio, scans, 2, &count) == ADS1115_OK);
+    CHECK(count == 2U);
+    total += count;
+    CHECK(ads1115_iio_buffer_read(&iio, &scans[total], RECORD_COUNT - total, &count) == ADS1115_OK);
+    total += count;
+    CHECK(total == RECORD_COUNT);
+    for (unsigned r = 0; r < total; r++)
+    {
+        float expected;
+        ads1115_raw_to_voltage(ADS1115_RANGE_0V256, RECORD_RAW[r], &expected);
+        CHECK(scans[r].scan_mask == ADS1115_IIO_SCAN_BIT(ADS1115_MUX_AIN0_GND));
+        CHECK(scans[r].adc_raw[ADS1115_MUX_AIN0_GND] == RECORD_RAW[r]);
+        CHECK(scans[r].voltage[ADS1115_MUX_AIN0_GND] == expected);
+        CHECK(scans[r].timestamp_ns == (int64_t)(1000000000LL + r * 2105263LL));
+    }
+    CHECK(ads1115_iio_buffer_read(&iio, scans, RECORD_COUNT, &count) == ADS1115_OK);
+    CHECK(count == 0U);
+
+    CHECK(ads1115_iio_buffer_stop(&iio) == ADS1115_OK);
+    CHECK(strcmp(get("sys/iio:device1/buffer/enable"), "0") == 0);
+    CHECK(ads1115_iio_deinit(&iio) == ADS1115_OK);
+
+    nftw(root, remove_entry, 16, FTW_DEPTH | FTW_PHYS);
+    printf("%s (%u failed)\n", failures ? "FAILED" : "passed", failures);
+    return failures ? 1 : 0;
+}
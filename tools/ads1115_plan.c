@@ -0,0 +1,456 @@
+/**
+ * @file ads1115_plan.c
+ * @brief ADS1115 Bus Capacity Planning Tool
+ * @version 1.0.0
+ * @author Şükrü Can Kılıç
+ * @date 18-10-2026
+ *
+ * @details Command line front end of the throughput planner. Each device is
+ * given as STRATEGY:SPS:CHANNELS, for example
+ *
+ *     ads1115_plan -c 400000 pipelined:860:4 start-collect:128:2 continuous:475:1
+ *
+ * With -v the model is checked against the driver itself: every operation and
+ * every strategy is run on a simulated bus and device in virtual time, counting
+ * transactions, bytes and SCL clocks, and the measured figures are compared with
+ * the modeled ones. The exit status is non-zero if they disagree.
+ *
+ * Build: cc -std=c99 -Isrc tools/ads1115_plan.c src/ads1115.c src/ads1115_planner.c src/ads1115_pipeline.c -o ads1115_plan
+ */
+
+#include "ads1115.h"
+#include "ads1115_pipeline.h"
+#include "ads1115_planner.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*===========================================================================*/
+/* PRIVATE CONSTANTS                                                         */
+/*===========================================================================*/
+
+#define PLAN_MAX_DEVICES 16
+
+/** @brief Samples simulated per device during validation */
+#define SIM_SAMPLES 256U
+
+/** @brief Accepted relative deviation between simulated and modeled sample time */
+#define SIM_TOLERANCE 0.01
+
+static const char *const STRATEGY_NAMES[] = {"blocking", "start-collect", "pipelined", "continuous"};
+static const unsigned RATE_SPS[] = {8, 16, 32, 64, 128, 250, 475, 860};
+
+/*===========================================================================*/
+/* SIMULATED BUS AND DEVICE                                                  */
+/*===========================================================================*/
+
+static struct
+{
+    ads1115_bus_model_t bus;
+    uint64_t now_ns;        /* Virtual clock */
+    uint64_t bus_ns;        /* Accumulated bus time */
+    uint32_t transactions;
+    uint32_t bytes;
+    uint32_t clocks;
+    uint64_t wait_ns;       /* Accumulated delay_ms time */
+    uint16_t regs[4];
+    bool converting;
+    uint64_t done_ns;       /* End of the running conversion */
+    uint16_t next_result;
+} sim;
+
+static uint64_t sim_conversion_ns(void)
+{
+    uint32_t us = 0;
+    ads1115_get_conversion_time_us((ads1115_data_rate_t)((sim.regs[1] >> 5) & 0x7U), &us);
+    return (uint64_t)us * 1000U;
+}
+
+/** @brief Completes conversions that have finished by now; continuous mode restarts them. */
+static void sim_advance(void)
+{
+    while (sim.converting && sim.done_ns <= sim.now_ns)
+    {
+        sim.regs[0] = sim.next_result++;
+        if (sim.regs[1] & 0x0100U)
+            sim.converting = false;
+        else
+            sim.done_ns += sim_conversion_ns();
+    }
+}
+
+static void sim_transaction(uint32_t bytes, uint32_t clocks)
+{
+    uint64_t ns = ((uint64_t)clocks * 1000000000U + sim.bus.bus_clock_hz - 1U) / sim.bus.bus_clock_hz;
+    ns += (uint64_t)sim.bus.txn_overhead_us * 1000U;
+    sim.transactions++;
+    sim.bytes += bytes;
+    sim.clocks += clocks;
+    sim.bus_ns += ns;
+    sim.now_ns += ns;
+    sim_advance();
+}
+
+static bool sim_write(uint8_t device_addr, uint8_t reg_addr, const uint8_t *data, uint8_t len)
+{
+    (void)device_addr;
+    /* S, addr+W, pointer, data, P */
+    sim_transaction(2U + len, 2U + 9U * (2U + len));
+    uint16_t value = (uint16_t)((data[0] << 8) | data[1]);
+    if (reg_addr == 1U)
+    {
+        sim.regs[1] = value & 0x7FFFU;
+        bool continuous = (value & 0x0100U) == 0;
+        if ((value & 0x8000U) || continuous)
+        {
+            sim.converting = true;
+            sim.done_ns = sim.now_ns + sim_conversion_ns();
+        }
+        else
+        {
+            sim.converting = false;
+        }
+    }
+    else
+    {
+        sim.regs[reg_addr & 3U] = value;
+    }
+    return true;
+}
+
+static bool sim_read(uint8_t device_addr, uint8_t reg_addr, uint8_t *data, uint8_t len)
+{
+    (void)device_addr;
+    if (sim.bus.split_read)
+    {
+        /* S, addr+W, pointer, P then S, addr+R, data, P */
+        sim_transaction(2U, 2U + 9U * 2U);
+        sim_transaction(1U + len, 2U + 9U * (1U + len));
+    }
+    else
+    {
+        /* S, addr+W, pointer, Sr, addr+R, data, P */
+        sim_transaction(3U + len, 3U + 9U * (3U + len));
+    }
+    uint16_t value = sim.regs[reg_addr & 3U];
+    if (reg_addr == 1U && !sim.converting)
+        value |= 0x8000U;
+    data[0] = (uint8_t)(value >> 8);
+    data[1] = (uint8_t)value;
+    return true;
+}
+
+static void sim_delay_ms(uint32_t milliseconds)
+{
+    sim.now_ns += (uint64_t)milliseconds * 1000000U;
+    sim.wait_ns += (uint64_t)milliseconds * 1000000U;
+    sim_advance();
+}
+
+static void sim_reset(void)
+{
+    ads1115_bus_model_t bus = sim.bus;
+    memset(&sim, 0, sizeof(sim));
+    sim.bus = bus;
+    sim.regs[1] = 0x0583U;
+}
+
+static void sim_clear_counters(void)
+{
+    sim.transactions = 0;
+    sim.bytes = 0;
+    sim.clocks = 0;
+    sim.bus_ns = 0;
+    sim.wait_ns = 0;
+}
+
+static void sim_handle(ads1115_handle_t *handle, ads1115_data_rate_t data_rate)
+{
+    ads1115_config_t config = ADS1115_DEFAULT_CONFIGURATION;
+    config.mode = ADS1115_MODE_SINGLE_SHOT;
+    config.data_rate = data_rate;
+    memset(handle, 0, sizeof(*handle));
+    handle->i2c_addr = 0x48;
+    handle->i2c_write = sim_write;
+    handle->i2c_read = sim_read;
+    handle->delay_ms = sim_delay_ms;
+    handle->config = config;
+    sim_reset();
+    ads1115_init(handle);
+    sim_clear_counters();
+}
+
+/*===========================================================================*/
+/* VALIDATION                                                                */
+/*===========================================================================*/
+
+/** @brief Runs one driver operation on the simulator. */
+static void run_op(ads1115_handle_t *handle, ads1115_op_t op)
+{
+    int16_t raw;
+    float voltage;
+    bool ready;
+    switch (op)
+    {
+    case ADS1115_OP_INIT:
+        ads1115_init(handle);
+        break;
+    case ADS1115_OP_WRITE_CONFIG:
+        ads1115_set_data_rate(handle, handle->config.data_rate);
+        break;
+    case ADS1115_OP_READ_CONFIG:
+        ads1115_is_ready(handle, &ready);
+        break;
+    case ADS1115_OP_SINGLE_READ:
+        ads1115_single_read(handle, &raw, &voltage);
+        break;
+    case ADS1115_OP_SINGLE_START:
+        ads1115_single_start(handle);
+        break;
+    case ADS1115_OP_READ_RESULT:
+        ads1115_single_collect(handle, &raw, &voltage);
+        break;
+    case ADS1115_OP_SET_THRESHOLD:
+        ads1115_set_compare_threshold(handle, -100, 100);
+        break;
+    }
+}
+
+static int validate_ops(void)
+{
+    static const char *const names[] = {"init", "write config", "read config", "single read", "single start", "read result",
+                                        "set threshold"};
+    int failures = 0;
+    printf("\noperation       txns bytes clocks   bus_us  wait_us   (simulated)\n");
+    for (int op = ADS1115_OP_INIT; op <= ADS1115_OP_SET_THRESHOLD; op++)
+    {
+        for (int rate = ADS1115_DR_8_SPS; rate <= ADS1115_DR_860_SPS; rate++)
+        {
+            ads1115_handle_t handle;
+            ads1115_op_cost_t cost;
+            sim_handle(&handle, (ads1115_data_rate_t)rate);
+            ads1115_planner_op_cost(&sim.bus, (ads1115_op_t)op, (ads1115_data_rate_t)rate, &cost);
+            run_op(&handle, (ads1115_op_t)op);
+
+            uint32_t bus_us = (uint32_t)((sim.bus_ns + 999U) / 1000U);
+            bool ok = sim.transactions == cost.transactions && sim.bytes == cost.bytes && sim.clocks == cost.clocks &&
+                      sim.wait_ns == (uint64_t)cost.wait_us * 1000U && bus_us <= cost.bus_us && cost.bus_us <= bus_us + cost.transactions;
+            if (!ok)
+                failures++;
+            if (rate == ADS1115_DR_860_SPS || !ok)
+            {
+                printf("%-14s %5u %5u %6u %8u %8u   ", names[op], cost.transactions, cost.bytes, cost.clocks, cost.bus_us, cost.wait_us);
+                if (ok)
+                    printf("match\n");
+                else
+                    printf("MISMATCH at %u SPS: %u txns, %u bytes, %u clocks\n", RATE_SPS[rate], sim.transactions, sim.bytes, sim.clocks);
+            }
+        }
+    }
+    return failures;
+}
+
+/** @brief Runs a device plan on the simulator and returns the mean sample and bus time. */
+static void simulate_device(const ads1115_plan_device_t *dev, double *sample_us, double *bus_us)
+{
+    ads1115_handle_t handle;
+    sim_handle(&handle, dev->data_rate);
+    uint64_t start_ns = sim.now_ns;
+    int16_t raw;
+    float voltage;
+
+    switch (dev->strategy)
+    {
+    case ADS1115_PLAN_BLOCKING:
+        for (uint32_t n = 0; n < SIM_SAMPLES; n++)
+        {
+            if (dev->channel_count > 1U)
+            {
+                /* The range setter pushes the whole config, including the new MUX */
+                handle.config.mux = (ads1115_mux_t)(n % dev->channel_count);
+                ads1115_set_range(&handle, handle.config.range);
+            }
+            ads1115_single_read(&handle, &raw, &voltage);
+        }
+        break;
+    case ADS1115_PLAN_START_COLLECT:
+    {
+        uint32_t worst = 0;
+        ads1115_get_conversion_time_max_us(dev->data_rate, &worst);
+        for (uint32_t n = 0; n < SIM_SAMPLES; n++)
+        {
+            handle.config.mux = (ads1115_mux_t)(n % dev->channel_count);
+            ads1115_single_start(&handle);
+            sim.now_ns += (uint64_t)worst * 1000U;
+            sim_advance();
+            ads1115_single_collect(&handle, &raw, &voltage);
+        }
+        break;
+    }
+    case ADS1115_PLAN_PIPELINED:
+    {
+        ads1115_pipeline_step_t steps[8];
+        ads1115_pipeline_t pipe;
+        for (uint8_t i = 0; i < dev->channel_count; i++)
+        {
+            steps[i].mux = (ads1115_mux_t)i;
+            steps[i].range = handle.config.range;
+            steps[i].data_rate = dev->data_rate;
+        }
+        ads1115_pipeline_init(&pipe, &handle, steps, dev->channel_count, NULL, NULL);
+        ads1115_op_cost_t start;
+        ads1115_planner_op_cost(&sim.bus, ADS1115_OP_SINGLE_START, dev->data_rate, &start);
+        pipe.start_bus_us = start.bus_us;
+        ads1115_pipeline_start(&pipe, SIM_SAMPLES, (uint32_t)(sim.now_ns / 1000U));
+        while (pipe.active)
+        {
+            uint32_t now_us = (uint32_t)(sim.now_ns / 1000U);
+            uint32_t due_us = ads1115_pipeline_next_event_us(&pipe, now_us);
+            sim.now_ns += (uint64_t)(due_us - now_us) * 1000U;
+            sim_advance();
+            ads1115_pipeline_service(&pipe, due_us);
+        }
+        break;
+    }
+    case ADS1115_PLAN_CONTINUOUS:
+        ads1115_continuous_conversion_start(&handle);
+        sim_clear_counters();
+        start_ns = sim.now_ns;
+        for (uint32_t n = 0; n < SIM_SAMPLES; n++)
+        {
+            /* Read on the ALERT/RDY edge of every conversion */
+            if (sim.done_ns > sim.now_ns)
+                sim.now_ns = sim.done_ns;
+            sim_advance();
+            ads1115_continuous_conversion_read(&handle, &raw, &voltage);
+        }
+        break;
+    }
+
+    *sample_us = (double)(sim.now_ns - start_ns) / 1000.0 / SIM_SAMPLES;
+    *bus_us = (double)sim.bus_ns / 1000.0 / SIM_SAMPLES;
+}
+
+static int validate_devices(const ads1115_plan_device_t *devices, uint8_t count)
+{
+    int failures = 0;
+    printf("\ndev  model sample_us  sim sample_us  model bus_us  sim bus_us\n");
+    for (uint8_t i = 0; i < count; i++)
+    {
+        double sample_us, bus_us;
+        simulate_device(&devices[i], &sample_us, &bus_us);
+        double deviation = (sample_us - devices[i].sample_us) / devices[i].sample_us;
+        bool ok = deviation < SIM_TOLERANCE && deviation > -SIM_TOLERANCE && bus_us <= devices[i].bus_us + 0.001;
+        if (!ok)
+            failures++;
+        printf("%-3u %16u %14.1f %13u %11.1f   %s\n", i, devices[i].sample_us, sample_us, devices[i].bus_us, bus_us,
+               ok ? "match" : "MISMATCH");
+    }
+    return failures;
+}
+
+/*===========================================================================*/
+/* COMMAND LINE                                                              */
+/*===========================================================================*/
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [-c SCL_HZ] [-o OVERHEAD_US] [-s] [-v] STRATEGY:SPS:CHANNELS...\n"
+            "  -c  I2C clock (default 400000)\n"
+            "  -o  fixed overhead per transaction in microseconds (default 0)\n"
+            "  -s  HAL uses a STOP between pointer write and read\n"
+            "  -v  validate the model against the driver on a simulated bus\n"
+            "  STRATEGY is blocking, start-collect, pipelined or continuous;\n"
+            "  SPS is one of 8 16 32 64 128 250 475 860; CHANNELS is 1..8\n",
+            argv0);
+}
+
+static bool parse_device(const char *spec, ads1115_plan_device_t *dev)
+{
+    char name[16];
+    unsigned sps, channels;
+    if (sscanf(spec, "%15[^:]:%u:%u", name, &sps, &channels) != 3)
+        return false;
+
+    int strategy = -1;
+    for (int i = 0; i < 4; i++)
+    {
+        if (strcmp(name, STRATEGY_NAMES[i]) == 0)
+            strategy = i;
+    }
+    int rate = -1;
+    for (int i = 0; i < 8; i++)
+    {
+        if (RATE_SPS[i] == sps)
+            rate = i;
+    }
+    if (strategy < 0 || rate < 0 || channels == 0 || channels > 8)
+        return false;
+
+    memset(dev, 0, sizeof(*dev));
+    dev->strategy = (ads1115_plan_strategy_t)strategy;
+    dev->data_rate = (ads1115_data_rate_t)rate;
+    dev->channel_count = (uint8_t)channels;
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    ads1115_bus_model_t bus = {400000, 0, false};
+    ads1115_plan_device_t devices[PLAN_MAX_DEVICES];
+    uint8_t count = 0;
+    bool validate = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+            bus.bus_clock_hz = (uint32_t)strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            bus.txn_overhead_us = (uint32_t)strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "-s") == 0)
+            bus.split_read = true;
+        else if (strcmp(argv[i], "-v") == 0)
+            validate = true;
+        else if (count < PLAN_MAX_DEVICES && parse_device(argv[i], &devices[count]))
+            count++;
+        else
+        {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (count == 0 || bus.bus_clock_hz == 0)
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    ads1115_plan_report_t report;
+    if (ads1115_planner_evaluate(&bus, devices, count, &report) != ADS1115_OK)
+    {
+        fprintf(stderr, "invalid plan (continuous mode serves exactly one channel)\n");
+        return 2;
+    }
+
+    printf("bus %u Hz, %u us/transaction, %s reads\n\n", bus.bus_clock_hz, bus.txn_overhead_us,
+           bus.split_read ? "split" : "repeated-start");
+    printf("dev strategy       sps ch  sample_us  bus_us  rate/ch_Hz  latency_us\n");
+    for (uint8_t i = 0; i < count; i++)
+    {
+        const ads1115_plan_device_t *dev = &devices[i];
+        printf("%-3u %-14s %3u %2u %10u %7u %11.1f %11u\n", i, STRATEGY_NAMES[dev->strategy], RATE_SPS[dev->data_rate],
+               dev->channel_count, dev->sample_us, dev->bus_us, dev->channel_rate_hz, dev->latency_us);
+    }
+    printf("\nbus demand %.1f%%, utilization %.1f%%%s\n", report.bus_demand * 100.0f, report.bus_utilization * 100.0f,
+           report.bus_limited ? " (bus-limited)" : "");
+    printf("total %.1f samples/s, worst-case latency %u us\n", report.total_rate_hz, report.max_latency_us);
+
+    if (!validate)
+        return 0;
+
+    sim.bus = bus;
+    int failures = validate_ops() + validate_devices(devices, count);
+    printf("\nvalidation %s\n", failures ? "FAILED" : "passed");
+    return failures ? 1 : 0;
+}